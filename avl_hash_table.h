@@ -1,399 +1,867 @@
-#ifndef AVL_HASH_TABLE_H
-#define AVL_HASH_TABLE_H
-
-#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
-#include <algorithm> // Wymagane dla std::max, uzywanego do obliczania wysokosci wezlow AVL
-
-// Implementacja 3: Hash Table z kubelkami zawierajacymi drzewa AVL
-// W tej implementacji, kazdy 'kubelek' (bucket) tabeli hashujacej
-// zamiast listy do rozwiazywania kolizji, uzywa zbalansowanego drzewa binarnego (AVL tree).
-class AVLHashTable : public HashTableBase {
-private:
-    // Struktura reprezentujaca pojedynczy wezel w drzewie AVL.
-    struct AVLNode {
-        int key;    // Klucz elementu
-        int value;  // Wartosc elementu
-        int height; // Wysokosc wezla (maksymalna dlugosc sciezki od tego wezla do liscia)
-        AVLNode* left; // Wskaznik do lewego dziecka
-        AVLNode* right; // Wskaznik do prawego dziecka
-
-        // Konstruktor wezla AVL. Poczatkowo wysokosc to 1 (samotny wezel).
-        AVLNode(int k, int v) : key(k), value(v), height(1), left(nullptr), right(nullptr) {}
-    };
-
-    std::vector<AVLNode*> table; // Glowna tabela - wektor wskaźników do korzeni drzew AVL
-    size_t table_size;           // Aktualny rozmiar (pojemnosc) wektora tabeli
-    size_t current_size;         // Liczba aktualnie przechowywanych elementow w calej tabeli (sumarycznie ze wszystkich drzew AVL)
-
-    // Maksymalny wspolczynnik wypelnienia. W przypadku drzew AVL, moze byc wyzszy niz
-    // w adresowaniu otwartym lub lancuchowaniu z listami, poniewaz operacje w drzewach
-    // sa logarytmiczne, co zmniejsza wplyw dlugosci lancucha.
-    static constexpr double MAX_LOAD_FACTOR = 1.0; // Czesto moze byc 1.0 lub wiecej
-
-    // --- Funkcje pomocnicze dla drzewa AVL ---
-
-    // Zwraca wysokosc wezla; 0 jesli wezel jest nullptr.
-    int get_height(AVLNode* node) {
-        return node ? node->height : 0;
-    }
-
-    // Oblicza wspolczynnik balansu wezla.
-    // > 1 oznacza, ze lewe poddrzewo jest za wysokie.
-    // < -1 oznacza, ze prawe poddrzewo jest za wysokie.
-    int get_balance(AVLNode* node) {
-        return node ? get_height(node->left) - get_height(node->right) : 0;
-    }
-
-    // Aktualizuje wysokosc wezla na podstawie wysokosci jego dzieci.
-    void update_height(AVLNode* node) {
-        if (node) {
-            node->height = 1 + std::max(get_height(node->left), get_height(node->right));
-        }
-    }
-
-   
-    AVLNode* rotate_right(AVLNode* y) {
-        AVLNode* x = y->left;
-        AVLNode* T2 = x->right;
-
-        // Wykonaj rotacje
-        x->right = y;
-        y->left = T2;
-
-        // Zaktualizuj wysokosci wezlow 'y' i 'x' (kolejnosc wazna!)
-        update_height(y);
-        update_height(x);
-
-        return x; // Zwraca nowy korzen
-    }
-
- 
-    AVLNode* rotate_left(AVLNode* x) {
-        AVLNode* y = x->right;
-        AVLNode* T2 = y->left;
-
-        // Wykonaj rotacje
-        y->left = x;
-        x->right = T2;
-
-        // Zaktualizuj wysokosci wezlow 'x' i 'y' (kolejnosc wazna!)
-        update_height(x);
-        update_height(y);
-
-        return y; // Zwraca nowy korzen
-    }
-
-    // Rekurencyjna funkcja wstawiajaca element do drzewa AVL.
-    // Zwraca korzen (potencjalnie nowy) poddrzewa.
-    // 'inserted' to flaga przekazywana przez referencje, informujaca czy wstawiono nowy element,
-    // czy tylko zaktualizowano istniejacy.
-    AVLNode* insert_avl(AVLNode* node, int key, int value, bool& inserted) {
-        // Standardowe wstawianie BST: jesli dotarlismy do nullptr, tworzymy nowy wezel.
-        if (!node) {
-            inserted = true; // Oznacz jako wstawiony nowy element
-            return new AVLNode(key, value);
-        }
-
-        // Przejdz do lewego lub prawego poddrzewa
-        if (key < node->key) {
-            node->left = insert_avl(node->left, key, value, inserted);
-        }
-        else if (key > node->key) {
-            node->right = insert_avl(node->right, key, value, inserted);
-        }
-        else {
-            // Klucz juz istnieje - aktualizuj wartosc i oznacz jako nie wstawiony nowy element.
-            node->value = value;
-            inserted = false;
-            return node; // Zwracamy niezmieniony wezel
-        }
-
-        // Po rekurencyjnym wywolaniu, aktualizuj wysokosc bieżącego wezla.
-        update_height(node);
-
-        // Sprawdz wspolczynnik balansu i wykonaj odpowiednie rotacje, jesli drzewo jest niezbalansowane.
-        int balance = get_balance(node);
-
-        // Cztery przypadki niezbalansowania AVL:
-
-        // 1. Lewa-lewa (Left-Left Case)
-        // Drzewo jest "przechylone" w lewo, a nowy element jest w lewym poddrzewie lewego dziecka.
-        if (balance > 1 && key < node->left->key) {
-            return rotate_right(node);
-        }
-
-        // 2. Prawa-prawa (Right-Right Case)
-        // Drzewo jest "przechylone" w prawo, a nowy element jest w prawym poddrzewie prawego dziecka.
-        if (balance < -1 && key > node->right->key) {
-            return rotate_left(node);
-        }
-
-        // 3. Lewa-prawa (Left-Right Case)
-        // Drzewo jest "przechylone" w lewo, ale nowy element jest w prawym poddrzewie lewego dziecka.
-        // Wymaga dwoch rotacji: lewo na dziecku, potem prawo na wezle.
-        if (balance > 1 && key > node->left->key) {
-            node->left = rotate_left(node->left); // Rotacja w lewo na lewym dziecku
-            return rotate_right(node);             // Rotacja w prawo na bieżącym wezle
-        }
-
-        // 4. Prawa-lewa (Right-Left Case)
-        // Drzewo jest "przechylone" w prawo, ale nowy element jest w lewym poddrzewie prawego dziecka.
-        // Wymaga dwoch rotacji: prawo na dziecku, potem lewo na wezle.
-        if (balance < -1 && key < node->right->key) {
-            node->right = rotate_right(node->right); // Rotacja w prawo na prawym dziecku
-            return rotate_left(node);                  // Rotacja w lewo na bieżącym wezle
-        }
-
-        return node; // Zwroc niezmieniony wezel, jesli jest zbalansowany
-    }
-
-    // Znajduje wezel z najmniejszym kluczem w danym poddrzewie (najbardziej na lewo).
-    AVLNode* find_min(AVLNode* node) {
-        while (node->left) {
-            node = node->left;
-        }
-        return node;
-    }
-
-    // Rekurencyjna funkcja usuwajaca element z drzewa AVL.
-    // Zwraca korzen (potencjalnie nowy) poddrzewa.
-    // 'removed' to flaga przekazywana przez referencje, informujaca czy element zostal usuniety.
-    AVLNode* remove_avl(AVLNode* node, int key, bool& removed) {
-        if (!node) {
-            removed = false; // Element nie znaleziony
-            return node;
-        }
-
-        // Standardowe usuwanie BST:
-        if (key < node->key) {
-            node->left = remove_avl(node->left, key, removed);
-        }
-        else if (key > node->key) {
-            node->right = remove_avl(node->right, key, removed);
-        }
-        else { // Znaleziono wezel do usuniecia (key == node->key)
-            removed = true; // Oznacz, ze element zostal znaleziony i bedzie usuniety
-
-            // Przypadek 1: Wezel z jednym dzieckiem lub bez dzieci
-            if (!node->left || !node->right) {
-                AVLNode* temp = node->left ? node->left : node->right;
-
-                if (!temp) { // Brak dzieci (wezel jest lisciem)
-                    temp = node; // temp wskazuje na wezel do usuniecia
-                    node = nullptr; // Ustaw wezel na nullptr
-                }
-                else { // Ma jedno dziecko
-                    *node = *temp; // Skopiuj dane dziecka do bieżącego wezla
-                }
-                delete temp; // Zwolnij pamiec starego wezla lub wezla-dziecka
-            }
-            else { // Przypadek 2: Wezel z dwoma dziecmi
-                // Znajdz nastepnika (najmniejszy element w prawym poddrzewie)
-                AVLNode* temp = find_min(node->right);
-                // Skopiuj dane nastepnika do bieżącego wezla
-                node->key = temp->key;
-                node->value = temp->value;
-
-                // Rekurencyjnie usun nastepnika z prawego poddrzewa
-                bool dummy_removed_flag; // Flaga tymczasowa, bo wiemy, ze element zostanie usuniety
-                node->right = remove_avl(node->right, temp->key, dummy_removed_flag);
-            }
-        }
-
-        // Jesli wezel stal sie nullptr (np. usunieto lisc), nie ma co balansowac.
-        if (!node) return node;
-
-        // Po rekurencyjnym wywolaniu, aktualizuj wysokosc bieżącego wezla.
-        update_height(node);
-
-        // Sprawdz wspolczynnik balansu i wykonaj rotacje w celu zbalansowania.
-        int balance = get_balance(node);
-
-        // Rotacje po usunieciu (podobne do wstawiania, ale warunki balansu sa inne):
-
-        // Lewa-lewa (Left-Left Case)
-        // Drzewo jest niezbalansowane w lewo, a lewe dziecko jest zbalansowane lub przechylone w lewo.
-        if (balance > 1 && get_balance(node->left) >= 0) {
-            return rotate_right(node);
-        }
-
-        // Lewa-prawa (Left-Right Case)
-        // Drzewo jest niezbalansowane w lewo, a lewe dziecko jest przechylone w prawo.
-        if (balance > 1 && get_balance(node->left) < 0) {
-            node->left = rotate_left(node->left); // Rotacja w lewo na lewym dziecku
-            return rotate_right(node);             // Rotacja w prawo na bieżącym wezle
-        }
-
-        // Prawa-prawa (Right-Right Case)
-        // Drzewo jest niezbalansowane w prawo, a prawe dziecko jest zbalansowane lub przechylone w prawo.
-        if (balance < -1 && get_balance(node->right) <= 0) {
-            return rotate_left(node);
-        }
-
-        // Prawa-lewa (Right-Left Case)
-        // Drzewo jest niezbalansowane w prawo, a prawe dziecko jest przechylone w lewo.
-        if (balance < -1 && get_balance(node->right) > 0) {
-            node->right = rotate_right(node->right); // Rotacja w prawo na prawym dziecku
-            return rotate_left(node);                  // Rotacja w lewo na bieżącym wezle
-        }
-
-        return node; // Zwroc zbalansowany wezel
-    }
-
-    // Rekurencyjna funkcja wyszukujaca element w drzewie AVL.
-    bool find_avl(AVLNode* node, int key, int& value) {
-        if (!node) return false; // Nie znaleziono elementu
-
-        if (key == node->key) { // Znaleziono element
-            value = node->value;
-            return true;
-        }
-        else if (key < node->key) { // Szukaj w lewym poddrzewie
-            return find_avl(node->left, key, value);
-        }
-        else { // Szukaj w prawym poddrzewie
-            return find_avl(node->right, key, value);
-        }
-    }
-
-    // Rekurencyjnie usuwa wszystkie wezly w drzewie (zwolnienie pamieci).
-    void clear_avl(AVLNode* node) {
-        if (node) {
-            clear_avl(node->left);  // Najpierw lewe poddrzewo
-            clear_avl(node->right); // Potem prawe poddrzewo
-            delete node;            // Na koncu bieżący wezel
-        }
-    }
-
-    // Rekurencyjna funkcja do wyswietlania drzewa AVL (inorder traversal, z wcieciami).
-    // Uzywane glownie do debugowania.
-    void display_avl(AVLNode* node, int depth = 0) {
-        if (node) {
-            display_avl(node->right, depth + 1); // Najpierw prawe dziecko (dla czytelniejszego widoku "drzewa")
-            for (int i = 0; i < depth; ++i) std::cout << "  "; // Wciecia dla poziomu zagniezdzenia
-            std::cout << "(" << node->key << "," << node->value << ")" << std::endl;
-            display_avl(node->left, depth + 1); // Potem lewe dziecko
-        }
-    }
-
-    // Zmienia rozmiar tabeli hashujacej, podwajajac jej pojemnosc.
-    // Wymaga ponownego wstawienia wszystkich elementow, poniewaz ich indeksy hash moga sie zmienic.
-    void resize() {
-        size_t old_size = table_size; // Zapisz stary rozmiar
-        auto old_table = std::move(table); // Przenies stara tabele (wektor korzeni AVL)
-
-        table_size *= 2; // Podwoj rozmiar tabeli
-        table.clear();   // Wyczysc nowa tabele
-        table.resize(table_size, nullptr); // Zmien rozmiar wektora, inicjujac wskaźniki na nullptr
-        current_size = 0; // Zresetuj licznik elementow
-
-        // Przepisz wszystkie elementy ze starej tabeli do nowej.
-        // Nalezy przejsc przez kazde drzewo AVL w starej tabeli, zebrac jego elementy,
-        // a nastepnie wstawic je ponownie do nowej tabeli.
-        for (AVLNode* root : old_table) {
-            if (root) {
-                collect_and_reinsert(root); // Zbierz elementy z drzewa i wstaw je
-                clear_avl(root); // Zwolnij pamiec starego drzewa po przepisaniu elementow
-            }
-        }
-    }
-
-    // Pomocnicza funkcja rekurencyjna do zbierania elementow z drzewa AVL
-    // i wstawiania ich do nowej (lub bieżącej) tabeli hashujacej podczas resize'u.
-    void collect_and_reinsert(AVLNode* node) {
-        if (node) {
-            insert(node->key, node->value); // Wstaw element do nowej tabeli
-            collect_and_reinsert(node->left);  // Rekurencyjnie dla lewego dziecka
-            collect_and_reinsert(node->right); // Rekurencyjnie dla prawego dziecka
-        }
-    }
-
-public:
-    // Konstruktor, inicjalizuje tabele z podanym rozmiarem poczatkowym.
-    // Kazdy element wektora jest inicjalizowany na nullptr (pusty kubel).
-    explicit AVLHashTable(size_t initial_size = 16)
-        : table_size(initial_size), current_size(0) {
-        table.resize(table_size, nullptr); // Ustaw poczatkowy rozmiar wektora wskaźników
-    }
-
-    // Destruktor. Zapewnia zwolnienie calej zaalokowanej pamieci dynamicznej
-    // dla wezlow AVL, wywolujac metode clear().
-    ~AVLHashTable() {
-        clear();
-    }
-
-    // Wstawia pare klucz-wartosc do tabeli.
-    // Zwraca true, jesli wstawienie/aktualizacja sie powiodla.
-    bool insert(int key, int value) override {
-        // Sprawdz wspolczynnik wypelnienia. Jesli przekroczony, zmien rozmiar tabeli.
-        if (static_cast<double>(current_size) / table_size > MAX_LOAD_FACTOR) {
-            resize();
-        }
-
-        size_t index = hash_function(key, table_size); // Oblicz indeks koszyka
-        bool inserted_new_node; // Flaga do sledzenia, czy nowy wezel zostal faktycznie wstawiony
-        table[index] = insert_avl(table[index], key, value, inserted_new_node); // Wstaw do drzewa AVL
-
-        if (inserted_new_node) {
-            current_size++; // Zwieksz licznik elementow tylko jesli dodano nowy wezel
-        }
-
-        return true; // Zawsze true, jesli operacja insert_avl sie powiodla
-    }
-
-    // Usuwa element z podanym kluczem z tabeli.
-    // Zwraca true, jesli element zostal usuniety, false w przeciwnym razie.
-    bool remove(int key) override {
-        size_t index = hash_function(key, table_size); // Oblicz indeks koszyka
-        bool removed_node; // Flaga do sledzenia, czy wezel zostal faktycznie usuniety
-        table[index] = remove_avl(table[index], key, removed_node); // Usun z drzewa AVL
-
-        if (removed_node) {
-            current_size--; // Zmniejsz licznik elementow tylko jesli usunieto wezel
-        }
-
-        return removed_node; // Zwroc true/false z funkcji remove_avl
-    }
-
-    // Znajduje wartosc skojarzona z podanym kluczem.
-    // Zwraca true, jesli klucz zostal znaleziony, a wartosc jest przypisana do 'value',
-    // false w przeciwnym razie.
-    bool find(int key, int& value) override {
-        size_t index = hash_function(key, table_size); // Oblicz indeks koszyka
-        return find_avl(table[index], key, value); // Szukaj w drzewie AVL
-    }
-
-    // Wyswietla zawartosc tabeli hashujacej.
-    void display() override {
-        std::cout << "=== AVL Hash Table ===" << std::endl;
-        for (size_t i = 0; i < table_size; ++i) {
-            std::cout << "Bucket " << i << ":" << std::endl;
-            if (table[i]) {
-                display_avl(table[i], 1); // Wyswietl drzewo AVL w danym kubku, z wcieciem 1
-            }
-            else {
-                std::cout << "  [EMPTY]" << std::endl; // Kubel jest pusty
-            }
-        }
-        std::cout << "Total Size: " << current_size << " / Table Capacity: " << table_size << std::endl; // Poprawiony opis rozmiaru
-    }
-
-    // Zwraca aktualna liczbe elementow w tabeli.
-    size_t size() const override { return current_size; }
-
-    // Czyści tabele, zwalniajac pamiec wszystkich drzew AVL i resetujac licznik.
-    void clear() override {
-        for (AVLNode*& root : table) { // Iteruj przez wszystkie korzenie drzew w tabeli
-            clear_avl(root); // Wyczysc kazde drzewo AVL (zwolnij pamiec wezlow)
-            root = nullptr; // Ustaw korzen na nullptr po usunieciu wezlow
-        }
-        current_size = 0; // Zresetuj licznik elementow
-    }
-
-    // Zwraca nazwe implementacji tabeli hashujacej.
-    std::string get_name() const override {
-        return "AVL Hash Table";
-    }
-};
-
-#endif // AVL_HASH_TABLE_H
+#ifndef AVL_HASH_TABLE_H
+#define AVL_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "node_arena.h"      // Pula wezlow z szybkim zwalnianiem wszystkich naraz
+#include "engine_registry.h" // Rejestracja w benchmarkach i demonstracji
+#include <algorithm> // Wymagane dla std::max, uzywanego do obliczania wysokosci wezlow AVL
+#include <cmath>     // std::ceil - nowy rozmiar przy wzroscie
+#include <cstdint>   // uint32_t dla licznika generacji
+#include <thread>    // Rownolegle freeze() / thaw() po zakresach kubelkow
+#if defined(_MSC_VER)
+#include <intrin.h>  // _BitScanForward64, _BitScanReverse64, _mm_prefetch
+#endif
+
+// Implementacja 3: Hash Table z kubelkami zawierajacymi drzewa AVL
+// W tej implementacji, kazdy 'kubelek' (bucket) tabeli hashujacej
+// zamiast listy do rozwiazywania kolizji, uzywa zbalansowanego drzewa binarnego (AVL tree).
+//
+// Tryb tylko do odczytu: freeze() zamienia drzewa wszystkich kubelkow na niejawne drzewa
+// w ukladzie Eytzingera (kolejnosc BFS, dzieci pozycji k na 2k i 2k+1) w jednej ciaglej tablicy,
+// a wezly wracaja do systemu. Szukanie nie sledzi wskaznikow: kazdy poziom to porownanie
+// i przesuniecie indeksu bez rozgalezien, a linie z potomkami kilku kolejnych poziomow sa
+// pobierane z wyprzedzeniem. thaw() odtwarza wezly AVL. Obie konwersje dziela kubelki miedzy watki.
+// Wstawienie nowego klucza lub usuniecie obecnego w stanie zamrozonym najpierw wywoluje thaw();
+// aktualizacja wartosci istniejacego klucza i chybione usuniecie nie rozmrazaja tabeli.
+class AVLHashTable : public HashTableBase {
+private:
+    // Struktura reprezentujaca pojedynczy wezel w drzewie AVL.
+    struct AVLNode {
+        int key;    // Klucz elementu
+        int value;  // Wartosc elementu
+        int height; // Wysokosc wezla (maksymalna dlugosc sciezki od tego wezla do liscia)
+        AVLNode* left; // Wskaznik do lewego dziecka
+        AVLNode* right; // Wskaznik do prawego dziecka
+
+        // Konstruktor wezla AVL. Poczatkowo wysokosc to 1 (samotny wezel).
+        AVLNode(int k, int v) : key(k), value(v), height(1), left(nullptr), right(nullptr) {}
+    };
+
+    // Kubelek: korzen drzewa AVL i generacja tabeli, w ktorej zostal zapisany.
+    // Korzen z innej generacji jest traktowany jako pusty (nullptr).
+    struct Bucket {
+        AVLNode* root = nullptr;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Bucket> table;   // Glowna tabela - wektor korzeni drzew AVL
+    size_t table_size;           // Aktualny rozmiar (pojemnosc) wektora tabeli
+    size_t current_size;         // Liczba aktualnie przechowywanych elementow w calej tabeli (sumarycznie ze wszystkich drzew AVL)
+    uint32_t generation;         // Biezaca generacja tabeli (zwiekszana przez clear)
+    NodeArena<AVLNode> arena;    // Pula, z ktorej pochodza wszystkie wezly tabeli
+    double max_load_factor;      // Wspolczynnik wypelnienia, po przekroczeniu ktorego tabela rosnie
+    double growth_factor;        // Krotnosc wzrostu liczby kubelkow przy resize()
+    uint64_t rotations = 0;      // Rotacje od utworzenia tabeli (podwojna liczona jako 2)
+
+    // Element zamrozonej tabeli; klucz i wartosc w jednej linii cache.
+    struct FrozenEntry {
+        int key;
+        int value;
+    };
+
+    // Stan zamrozony: wektor korzeni i arena sa zwolnione, kubelek i to niejawne drzewo
+    // frozen_entries[frozen_offsets[i] .. frozen_offsets[i + 1]) w ukladzie Eytzingera.
+    bool frozen = false;
+    std::vector<FrozenEntry> frozen_entries;
+    std::vector<size_t> frozen_offsets; // table_size + 1 pozycji
+
+    // Zwraca referencje do korzenia kubelka, zerujac go najpierw, jesli pochodzi z poprzedniej generacji.
+    AVLNode*& root_at(size_t index) {
+        Bucket& bucket = table[index];
+        if (bucket.generation != generation) {
+            bucket.root = nullptr;
+            bucket.generation = generation;
+        }
+        return bucket.root;
+    }
+
+    // Korzen kubelka bez modyfikacji tabeli: kubelek z poprzedniej generacji jest pusty.
+    // Uzywany przez wyszukiwanie i wyswietlanie (takze przy odczycie z wielu watkow).
+    AVLNode* live_root(size_t index) const {
+        const Bucket& bucket = table[index];
+        return bucket.generation == generation ? bucket.root : nullptr;
+    }
+
+    // Domyslny maksymalny wspolczynnik wypelnienia. W przypadku drzew AVL, moze byc wyzszy niz
+    // w adresowaniu otwartym lub lancuchowaniu z listami, poniewaz operacje w drzewach
+    // sa logarytmiczne, co zmniejsza wplyw dlugosci lancucha.
+    static constexpr double DEFAULT_MAX_LOAD_FACTOR = 1.0; // Czesto moze byc 1.0 lub wiecej
+    static constexpr double LOAD_FACTOR_LIMIT = 64.0;      // Gorna granica (sredni rozmiar drzewa)
+    static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
+    static constexpr double GROWTH_FACTOR_LIMIT = 4.0;
+
+    static constexpr size_t PREFETCH_LEVELS = 3;          // 2^3 elementow po 8 B = linia z wnukami wnukow
+    static constexpr size_t PREFETCH_MIN_ENTRIES = 16;    // Mniejsze drzewa mieszcza sie w 1-2 liniach
+    static constexpr size_t MIN_BUCKETS_PER_THREAD = 4096; // Mniejsze zakresy nie oplacaja watku
+
+    bool over_load_factor() const {
+        return static_cast<double>(current_size) / table_size > max_load_factor;
+    }
+
+    // --- Funkcje pomocnicze dla drzewa AVL ---
+
+    // Zwraca wysokosc wezla; 0 jesli wezel jest nullptr.
+    int get_height(AVLNode* node) {
+        return node ? node->height : 0;
+    }
+
+    // Oblicza wspolczynnik balansu wezla.
+    // > 1 oznacza, ze lewe poddrzewo jest za wysokie.
+    // < -1 oznacza, ze prawe poddrzewo jest za wysokie.
+    int get_balance(AVLNode* node) {
+        return node ? get_height(node->left) - get_height(node->right) : 0;
+    }
+
+    // Aktualizuje wysokosc wezla na podstawie wysokosci jego dzieci.
+    void update_height(AVLNode* node) {
+        if (node) {
+            node->height = 1 + std::max(get_height(node->left), get_height(node->right));
+        }
+    }
+
+   
+    AVLNode* rotate_right(AVLNode* y) {
+        AVLNode* x = y->left;
+        AVLNode* T2 = x->right;
+
+        // Wykonaj rotacje
+        x->right = y;
+        y->left = T2;
+
+        // Zaktualizuj wysokosci wezlow 'y' i 'x' (kolejnosc wazna!)
+        update_height(y);
+        update_height(x);
+        ++rotations;
+
+        return x; // Zwraca nowy korzen
+    }
+
+ 
+    AVLNode* rotate_left(AVLNode* x) {
+        AVLNode* y = x->right;
+        AVLNode* T2 = y->left;
+
+        // Wykonaj rotacje
+        y->left = x;
+        x->right = T2;
+
+        // Zaktualizuj wysokosci wezlow 'x' i 'y' (kolejnosc wazna!)
+        update_height(x);
+        update_height(y);
+        ++rotations;
+
+        return y; // Zwraca nowy korzen
+    }
+
+    // Rekurencyjna funkcja wstawiajaca element do drzewa AVL.
+    // Zwraca korzen (potencjalnie nowy) poddrzewa.
+    // 'inserted' to flaga przekazywana przez referencje, informujaca czy wstawiono nowy element,
+    // czy tylko zaktualizowano istniejacy.
+    AVLNode* insert_avl(AVLNode* node, int key, int value, bool& inserted) {
+        // Standardowe wstawianie BST: jesli dotarlismy do nullptr, tworzymy nowy wezel.
+        if (!node) {
+            inserted = true; // Oznacz jako wstawiony nowy element
+            return arena.create(key, value);
+        }
+
+        // Przejdz do lewego lub prawego poddrzewa
+        if (key < node->key) {
+            node->left = insert_avl(node->left, key, value, inserted);
+        }
+        else if (key > node->key) {
+            node->right = insert_avl(node->right, key, value, inserted);
+        }
+        else {
+            // Klucz juz istnieje - aktualizuj wartosc i oznacz jako nie wstawiony nowy element.
+            node->value = value;
+            inserted = false;
+            return node; // Zwracamy niezmieniony wezel
+        }
+
+        // Po rekurencyjnym wywolaniu, aktualizuj wysokosc bieżącego wezla.
+        update_height(node);
+
+        // Sprawdz wspolczynnik balansu i wykonaj odpowiednie rotacje, jesli drzewo jest niezbalansowane.
+        int balance = get_balance(node);
+
+        // Cztery przypadki niezbalansowania AVL:
+
+        // 1. Lewa-lewa (Left-Left Case)
+        // Drzewo jest "przechylone" w lewo, a nowy element jest w lewym poddrzewie lewego dziecka.
+        if (balance > 1 && key < node->left->key) {
+            return rotate_right(node);
+        }
+
+        // 2. Prawa-prawa (Right-Right Case)
+        // Drzewo jest "przechylone" w prawo, a nowy element jest w prawym poddrzewie prawego dziecka.
+        if (balance < -1 && key > node->right->key) {
+            return rotate_left(node);
+        }
+
+        // 3. Lewa-prawa (Left-Right Case)
+        // Drzewo jest "przechylone" w lewo, ale nowy element jest w prawym poddrzewie lewego dziecka.
+        // Wymaga dwoch rotacji: lewo na dziecku, potem prawo na wezle.
+        if (balance > 1 && key > node->left->key) {
+            node->left = rotate_left(node->left); // Rotacja w lewo na lewym dziecku
+            return rotate_right(node);             // Rotacja w prawo na bieżącym wezle
+        }
+
+        // 4. Prawa-lewa (Right-Left Case)
+        // Drzewo jest "przechylone" w prawo, ale nowy element jest w lewym poddrzewie prawego dziecka.
+        // Wymaga dwoch rotacji: prawo na dziecku, potem lewo na wezle.
+        if (balance < -1 && key < node->right->key) {
+            node->right = rotate_right(node->right); // Rotacja w prawo na prawym dziecku
+            return rotate_left(node);                  // Rotacja w lewo na bieżącym wezle
+        }
+
+        return node; // Zwroc niezmieniony wezel, jesli jest zbalansowany
+    }
+
+    // Przywraca balans wezla po zmianie wysokosci jednego z poddrzew
+    // (usuniecie lub doczepienie wezla). Zwraca korzen (potencjalnie nowy) poddrzewa.
+    AVLNode* rebalance(AVLNode* node) {
+        // Aktualizuj wysokosc bieżącego wezla.
+        update_height(node);
+
+        // Sprawdz wspolczynnik balansu i wykonaj rotacje w celu zbalansowania.
+        int balance = get_balance(node);
+
+        // Lewa-lewa (Left-Left Case)
+        // Drzewo jest niezbalansowane w lewo, a lewe dziecko jest zbalansowane lub przechylone w lewo.
+        if (balance > 1 && get_balance(node->left) >= 0) {
+            return rotate_right(node);
+        }
+
+        // Lewa-prawa (Left-Right Case)
+        // Drzewo jest niezbalansowane w lewo, a lewe dziecko jest przechylone w prawo.
+        if (balance > 1 && get_balance(node->left) < 0) {
+            node->left = rotate_left(node->left); // Rotacja w lewo na lewym dziecku
+            return rotate_right(node);             // Rotacja w prawo na bieżącym wezle
+        }
+
+        // Prawa-prawa (Right-Right Case)
+        // Drzewo jest niezbalansowane w prawo, a prawe dziecko jest zbalansowane lub przechylone w prawo.
+        if (balance < -1 && get_balance(node->right) <= 0) {
+            return rotate_left(node);
+        }
+
+        // Prawa-lewa (Right-Left Case)
+        // Drzewo jest niezbalansowane w prawo, a prawe dziecko jest przechylone w lewo.
+        if (balance < -1 && get_balance(node->right) > 0) {
+            node->right = rotate_right(node->right); // Rotacja w prawo na prawym dziecku
+            return rotate_left(node);                  // Rotacja w lewo na bieżącym wezle
+        }
+
+        return node; // Zwroc zbalansowany wezel
+    }
+
+    // Odlacza wezel z najmniejszym kluczem (najbardziej na lewo) z poddrzewa.
+    // Odlaczony wezel trafia do 'min_node', funkcja zwraca nowy korzen poddrzewa.
+    AVLNode* detach_min(AVLNode* node, AVLNode*& min_node) {
+        if (!node->left) {
+            min_node = node;
+            return node->right;
+        }
+        node->left = detach_min(node->left, min_node);
+        return rebalance(node);
+    }
+
+    // Rekurencyjna funkcja usuwajaca element z drzewa AVL.
+    // Zwraca korzen (potencjalnie nowy) poddrzewa.
+    // 'removed' to flaga przekazywana przez referencje, informujaca czy element zostal usuniety.
+    // Wezly nie sa kopiowane - usuwany wezel jest zastepowany przez przepiecie wskaznikow,
+    // dzieki czemu wskazniki do wartosci pozostalych elementow pozostaja wazne.
+    AVLNode* remove_avl(AVLNode* node, int key, bool& removed) {
+        if (!node) {
+            removed = false; // Element nie znaleziony
+            return node;
+        }
+
+        // Standardowe usuwanie BST:
+        if (key < node->key) {
+            node->left = remove_avl(node->left, key, removed);
+        }
+        else if (key > node->key) {
+            node->right = remove_avl(node->right, key, removed);
+        }
+        else { // Znaleziono wezel do usuniecia (key == node->key)
+            removed = true; // Oznacz, ze element zostal znaleziony i bedzie usuniety
+
+            // Przypadek 1: Wezel z jednym dzieckiem lub bez dzieci - dziecko zajmuje jego miejsce
+            if (!node->left || !node->right) {
+                AVLNode* child = node->left ? node->left : node->right;
+                arena.destroy(node);
+                return child; // Poddrzewo z jednym wezlem (lub puste) jest zbalansowane
+            }
+
+            // Przypadek 2: Wezel z dwoma dziecmi
+            // Odlacz nastepnika (najmniejszy element w prawym poddrzewie) i wstaw go w miejsce usuwanego wezla.
+            AVLNode* successor = nullptr;
+            AVLNode* right = detach_min(node->right, successor);
+            successor->left = node->left;
+            successor->right = right;
+            arena.destroy(node);
+            node = successor;
+        }
+
+        // Po rekurencyjnym wywolaniu przywroc balans bieżącego wezla.
+        return rebalance(node);
+    }
+
+    // Doczepia istniejacy (odlaczony) wezel do drzewa AVL bez alokacji.
+    // Uzywane przy resize, aby wezly - a wiec i wskazniki do wartosci - nie zmienialy adresu.
+    AVLNode* insert_node_avl(AVLNode* node, AVLNode* fresh) {
+        if (!node) {
+            return fresh;
+        }
+
+        if (fresh->key < node->key) {
+            node->left = insert_node_avl(node->left, fresh);
+        }
+        else {
+            node->right = insert_node_avl(node->right, fresh);
+        }
+
+        return rebalance(node);
+    }
+
+    // Iteracyjnie szuka wezla z podanym kluczem. Zwraca nullptr, jesli go nie ma.
+    static const AVLNode* find_node_avl(const AVLNode* node, int key) {
+        while (node && node->key != key) {
+            node = key < node->key ? node->left : node->right;
+        }
+        return node;
+    }
+
+    // Rekurencyjnie odwiedza wezly drzewa w kolejnosci inorder (rosnace klucze).
+    static void for_each_avl(const AVLNode* node, const std::function<void(int, int)>& visit) {
+        if (node) {
+            for_each_avl(node->left, visit);
+            visit(node->key, node->value);
+            for_each_avl(node->right, visit);
+        }
+    }
+
+    // Sumuje glebokosci wezlow (porownania przy trafieniu) i pustych dzieci (przy chybieniu);
+    // 'misses' liczy puste dzieci.
+    static void probe_depths_avl(const AVLNode* node, size_t depth, double& hit_total, double& miss_total,
+                                 double& misses, size_t& max_depth) {
+        if (!node) {
+            miss_total += static_cast<double>(depth);
+            misses += 1;
+            return;
+        }
+        hit_total += static_cast<double>(depth + 1);
+        max_depth = std::max(max_depth, depth + 1);
+        probe_depths_avl(node->left, depth + 1, hit_total, miss_total, misses, max_depth);
+        probe_depths_avl(node->right, depth + 1, hit_total, miss_total, misses, max_depth);
+    }
+
+    // Rekurencyjna funkcja do wyswietlania drzewa AVL (inorder traversal, z wcieciami).
+    // Uzywane glownie do debugowania.
+    void display_avl(AVLNode* node, int depth = 0) {
+        if (node) {
+            display_avl(node->right, depth + 1); // Najpierw prawe dziecko (dla czytelniejszego widoku "drzewa")
+            for (int i = 0; i < depth; ++i) std::cout << "  "; // Wciecia dla poziomu zagniezdzenia
+            std::cout << "(" << node->key << "," << node->value << ")" << std::endl;
+            display_avl(node->left, depth + 1); // Potem lewe dziecko
+        }
+    }
+
+    // Alokuje wektor korzeni przy pierwszym wstawieniu (pusta tabela nie zajmuje pamieci).
+    void ensure_allocated() {
+        if (table.empty()) {
+            if (table_size == 0) table_size = 1;
+            table.resize(table_size);
+        }
+    }
+
+    // Zmienia rozmiar tabeli hashujacej, zwiekszajac jej pojemnosc 'growth_factor' razy.
+    // Istniejace wezly sa przepinane do nowych kubelkow (bez ponownej alokacji),
+    // poniewaz ich indeksy hash moga sie zmienic.
+    void resize() {
+        auto old_table = std::move(table); // Przenies stara tabele (wektor korzeni AVL)
+
+        size_t grown = static_cast<size_t>(std::ceil(table_size * growth_factor));
+        table_size = grown > table_size ? grown : table_size + 1; // Powieksz rozmiar tabeli
+        table.clear();   // Wyczysc nowa tabele
+        table.resize(table_size); // Zmien rozmiar wektora (puste kubelki)
+
+        // Przejdz przez kazde drzewo AVL w starej tabeli i przepnij jego wezly do nowej tabeli.
+        for (const Bucket& bucket : old_table) {
+            if (bucket.generation == generation) {
+                relink_tree(bucket.root);
+            }
+        }
+    }
+
+    // Pomocnicza funkcja rekurencyjna (postorder) przepinajaca wezly drzewa
+    // do nowych kubelkow podczas resize'u. Dzieci sa odczytywane przed wyzerowaniem wezla.
+    void relink_tree(AVLNode* node) {
+        if (node) {
+            relink_tree(node->left);  // Rekurencyjnie dla lewego dziecka
+            relink_tree(node->right); // Rekurencyjnie dla prawego dziecka
+
+            node->left = nullptr;
+            node->right = nullptr;
+            node->height = 1;
+            size_t index = hash_function(node->key, table_size);
+            AVLNode*& root = root_at(index);
+            root = insert_node_avl(root, node);
+        }
+    }
+
+    // --- Stan zamrozony (uklad Eytzingera) ---
+
+    static size_t count_avl(const AVLNode* node) {
+        return node ? 1 + count_avl(node->left) + count_avl(node->right) : 0;
+    }
+
+    // Pierwsza pozycja (najmniejszy klucz) niejawnego drzewa z 'count' elementami; pozycje od 1, 0 - brak.
+    static size_t eytzinger_first(size_t count) {
+        if (count == 0) return 0;
+        size_t k = 1;
+        while (2 * k <= count) k *= 2;
+        return k;
+    }
+
+    // Nastepna pozycja w kolejnosci inorder (rosnace klucze); 0 po ostatniej.
+    static size_t eytzinger_next(size_t k, size_t count) {
+        if (2 * k + 1 <= count) {
+            k = 2 * k + 1;
+            while (2 * k <= count) k *= 2;
+            return k;
+        }
+        while (k & 1) k >>= 1; // Wroc z prawych poddrzew
+        return k >> 1;
+    }
+
+    // Przepisuje drzewo AVL inorder na pozycje Eytzingera (przechodzone takze inorder).
+    static void fill_eytzinger(const AVLNode* node, FrozenEntry* entries, size_t count, size_t& position) {
+        if (node) {
+            fill_eytzinger(node->left, entries, count, position);
+            entries[position - 1] = { node->key, node->value };
+            position = eytzinger_next(position, count);
+            fill_eytzinger(node->right, entries, count, position);
+        }
+    }
+
+    // Buduje idealnie zbalansowane drzewo AVL z wezlow posortowanych wg klucza.
+    static AVLNode* build_balanced(AVLNode* const* nodes, size_t count) {
+        if (count == 0) return nullptr;
+        size_t middle = count / 2;
+        AVLNode* root = nodes[middle];
+        root->left = build_balanced(nodes, middle);
+        root->right = build_balanced(nodes + middle + 1, count - middle - 1);
+        root->height = 1 + std::max(root->left ? root->left->height : 0, root->right ? root->right->height : 0);
+        return root;
+    }
+
+    // Wywoluje 'work(begin, end)' dla ciaglych zakresow kubelkow [0, table_size) w osobnych watkach
+    // (biezacy watek bierze pierwszy zakres). Zakresy sa rozlaczne, wiec 'work' nie potrzebuje blokad.
+    template <class Work>
+    void parallel_for_buckets(Work work) const {
+        size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = std::min(threads, std::max<size_t>(1, table_size / MIN_BUCKETS_PER_THREAD));
+        size_t chunk = (table_size + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        for (size_t begin = chunk; begin < table_size; begin += chunk) {
+            workers.emplace_back(work, begin, std::min(table_size, begin + chunk));
+        }
+        work(0, std::min(table_size, chunk));
+        for (auto& worker : workers) worker.join();
+    }
+
+    // Pobranie linii z wyprzedzeniem (wskazowka dla procesora, bez efektu na wynik).
+    static void prefetch_read(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+    // Indeks najmlodszego / najstarszego ustawionego bitu (wartosc musi byc niezerowa).
+    static unsigned int lowest_set_bit64(uint64_t value) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<unsigned int>(index);
+#else
+        return static_cast<unsigned int>(__builtin_ctzll(value));
+#endif
+    }
+
+    static unsigned int highest_set_bit64(uint64_t value) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<unsigned int>(index);
+#else
+        return static_cast<unsigned int>(63 - __builtin_clzll(value));
+#endif
+    }
+
+    // Szukanie w zamrozonym kubelku. Petla nie ma rozgalezien zaleznych od danych: schodzi do
+    // pozycji za lisciem (k = 2k + [klucz < szukany]), a wynikiem jest ostatnia pozycja, w ktorej
+    // poszla w lewo - usuniecie koncowych jedynek i jednego zera z k. W wiekszych drzewach
+    // pobiera linie z potomkami pozycji k o PREFETCH_LEVELS poziomow nizej; w ostatnich poziomach
+    // ten indeks wychodzi poza kubelek, wiec jest ograniczany do ostatniej pozycji.
+    const FrozenEntry* find_frozen(int key) const {
+        size_t index = hash_function(key, table_size);
+        const FrozenEntry* entries = frozen_entries.data() + frozen_offsets[index];
+        size_t count = frozen_offsets[index + 1] - frozen_offsets[index];
+        size_t k = 1;
+        if (count >= PREFETCH_MIN_ENTRIES) {
+            while (k <= count) {
+                prefetch_read(entries + std::min((k << PREFETCH_LEVELS) - 1, count - 1));
+                k = 2 * k + (entries[k - 1].key < key);
+            }
+        }
+        else {
+            while (k <= count) {
+                k = 2 * k + (entries[k - 1].key < key);
+            }
+        }
+        k >>= lowest_set_bit64(~static_cast<uint64_t>(k)) + 1;
+        return k && entries[k - 1].key == key ? &entries[k - 1] : nullptr;
+    }
+
+    // Porownania przy szukaniu w zamrozonym kubelku: petla zawsze schodzi az za lisc, wiec
+    // trafienie kosztuje tyle co chybienie konczace sie na tej samej pozycji.
+    static size_t frozen_probe_length(const FrozenEntry* entries, size_t count, int key) {
+        size_t k = 1;
+        size_t length = 0;
+        while (k <= count) {
+            k = 2 * k + (entries[k - 1].key < key);
+            ++length;
+        }
+        return length;
+    }
+
+    bool frozen_probe_stats(ProbeStats& stats) const {
+        double hit_total = 0;
+        double miss_total = 0;
+        for (size_t i = 0; i < table_size; ++i) {
+            const FrozenEntry* entries = frozen_entries.data() + frozen_offsets[i];
+            size_t count = frozen_offsets[i + 1] - frozen_offsets[i];
+            if (count == 0) continue;
+            for (size_t j = 0; j < count; ++j) {
+                size_t length = frozen_probe_length(entries, count, entries[j].key);
+                hit_total += static_cast<double>(length);
+                stats.max_hit = std::max(stats.max_hit, length);
+            }
+            // Chybienie konczy sie na jednej z count + 1 pozycji za lisciem: k w [count + 1, 2count + 1],
+            // po floor(log2 k) porownaniach
+            double bucket_miss = 0;
+            for (size_t k = count + 1; k <= 2 * count + 1; ++k) {
+                bucket_miss += static_cast<double>(highest_set_bit64(k));
+            }
+            miss_total += bucket_miss / static_cast<double>(count + 1);
+        }
+        stats.average_hit = current_size ? hit_total / static_cast<double>(current_size) : 0.0;
+        stats.average_miss = miss_total / static_cast<double>(table_size);
+        return true;
+    }
+
+public:
+    // Konstruktor, zapamietuje rozmiar poczatkowy. Wektor korzeni (nullptr = pusty kubel)
+    // jest alokowany leniwie - przy pierwszym insert.
+    // Wartosci spoza dozwolonego zakresu sa ignorowane (patrz set_max_load_factor / set_growth_factor).
+    explicit AVLHashTable(size_t initial_size = 16, double max_load_factor = DEFAULT_MAX_LOAD_FACTOR,
+                          double growth_factor = DEFAULT_GROWTH_FACTOR)
+        : table_size(initial_size), current_size(0), generation(1),
+          max_load_factor(DEFAULT_MAX_LOAD_FACTOR), growth_factor(DEFAULT_GROWTH_FACTOR) {
+        set_max_load_factor(max_load_factor);
+        set_growth_factor(growth_factor);
+    }
+
+    // Wstawia pare klucz-wartosc do tabeli.
+    // Zwraca true, jesli wstawienie/aktualizacja sie powiodla.
+    bool insert(int key, int value) override {
+        if (frozen) {
+            if (int* found = find_ptr(key)) {
+                *found = value; // Aktualizacja nie zmienia ukladu
+                return true;
+            }
+            thaw();
+        }
+        ensure_allocated();
+
+        // Sprawdz wspolczynnik wypelnienia. Jesli przekroczony, zmien rozmiar tabeli.
+        if (over_load_factor()) {
+            resize();
+        }
+
+        size_t index = hash_function(key, table_size); // Oblicz indeks koszyka
+        bool inserted_new_node; // Flaga do sledzenia, czy nowy wezel zostal faktycznie wstawiony
+        AVLNode*& root = root_at(index);
+        root = insert_avl(root, key, value, inserted_new_node); // Wstaw do drzewa AVL
+
+        if (inserted_new_node) {
+            current_size++; // Zwieksz licznik elementow tylko jesli dodano nowy wezel
+        }
+
+        return true; // Zawsze true, jesli operacja insert_avl sie powiodla
+    }
+
+    // Usuwa element z podanym kluczem z tabeli.
+    // Zwraca true, jesli element zostal usuniety, false w przeciwnym razie.
+    bool remove(int key) override {
+        if (frozen) {
+            if (!find_frozen(key)) return false;
+            thaw();
+        }
+        if (table.empty()) return false; // Tabela jeszcze niezaalokowana
+
+        size_t index = hash_function(key, table_size); // Oblicz indeks koszyka
+        bool removed_node; // Flaga do sledzenia, czy wezel zostal faktycznie usuniety
+        AVLNode*& root = root_at(index);
+        root = remove_avl(root, key, removed_node); // Usun z drzewa AVL
+
+        if (removed_node) {
+            current_size--; // Zmniejsz licznik elementow tylko jesli usunieto wezel
+        }
+
+        return removed_node; // Zwroc true/false z funkcji remove_avl
+    }
+
+    // Znajduje wartosc skojarzona z podanym kluczem.
+    // Zwraca true, jesli klucz zostal znaleziony, a wartosc jest przypisana do 'value',
+    // false w przeciwnym razie.
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Zwraca wskaznik do wartosci w wezle AVL lub nullptr.
+    // Wezly sa stabilne: wskaznik pozostaje wazny az do usuniecia tego klucza
+    // (lub clear/zniszczenia tabeli) - insert, resize i usuwanie innych kluczy go nie uniewazniaja.
+    // Wyjatek: freeze() i thaw() przenosza wszystkie elementy i uniewazniaja wczesniejsze wskazniki.
+    const int* find_ptr(int key) const override {
+        if (frozen) {
+            const FrozenEntry* entry = find_frozen(key);
+            return entry ? &entry->value : nullptr;
+        }
+        if (table.empty()) return nullptr; // Tabela jeszcze niezaalokowana
+
+        size_t index = hash_function(key, table_size); // Oblicz indeks koszyka
+        const AVLNode* node = find_node_avl(live_root(index), key); // Szukaj w drzewie AVL
+        return node ? &node->value : nullptr;
+    }
+
+    int* find_ptr(int key) override {
+        return const_cast<int*>(static_cast<const AVLHashTable*>(this)->find_ptr(key));
+    }
+
+    // Wywoluje 'visit' dla kazdego elementu; w obrebie kubelka w kolejnosci rosnacych kluczy.
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        if (frozen) {
+            for (size_t i = 0; i < table_size; ++i) {
+                const FrozenEntry* entries = frozen_entries.data() + frozen_offsets[i];
+                size_t count = frozen_offsets[i + 1] - frozen_offsets[i];
+                for (size_t k = eytzinger_first(count); k; k = eytzinger_next(k, count)) {
+                    visit(entries[k - 1].key, entries[k - 1].value);
+                }
+            }
+            return;
+        }
+        for (const Bucket& bucket : table) {
+            if (bucket.generation == generation) {
+                for_each_avl(bucket.root, visit);
+            }
+        }
+    }
+
+    // Wyswietla zawartosc tabeli hashujacej.
+    void display() override {
+        std::cout << "=== AVL Hash Table ===" << std::endl;
+        if (frozen) {
+            // Elementy w kolejnosci tablicy (BFS), nie inorder
+            for (size_t i = 0; i < table_size; ++i) {
+                std::cout << "Bucket " << i << " (frozen):";
+                if (frozen_offsets[i] == frozen_offsets[i + 1]) std::cout << " [EMPTY]";
+                for (size_t j = frozen_offsets[i]; j < frozen_offsets[i + 1]; ++j) {
+                    std::cout << " (" << frozen_entries[j].key << "," << frozen_entries[j].value << ")";
+                }
+                std::cout << std::endl;
+            }
+            std::cout << "Total Size: " << current_size << " / Table Capacity: " << table_size << " (frozen)" << std::endl;
+            return;
+        }
+        for (size_t i = 0; i < table.size(); ++i) {
+            std::cout << "Bucket " << i << ":" << std::endl;
+            if (live_root(i)) {
+                display_avl(live_root(i), 1); // Wyswietl drzewo AVL w danym kubku, z wcieciem 1
+            }
+            else {
+                std::cout << "  [EMPTY]" << std::endl; // Kubel jest pusty
+            }
+        }
+        std::cout << "Total Size: " << current_size << " / Table Capacity: " << table_size << std::endl; // Poprawiony opis rozmiaru
+    }
+
+    // Zwraca aktualna liczbe elementow w tabeli.
+    size_t size() const override { return current_size; }
+
+    // Obiekt, wektor korzeni i bloki areny (takze wolne sloty); w stanie zamrozonym tablice Eytzingera.
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(table.capacity() * sizeof(Bucket)) + arena.capacity_bytes() +
+               heap_block_bytes(frozen_entries.capacity() * sizeof(FrozenEntry)) +
+               heap_block_bytes(frozen_offsets.capacity() * sizeof(size_t));
+    }
+
+    // Wezly porownane przy szukaniu: trafienie - glebokosc wezla, chybienie - srednia glebokosc
+    // pustych dzieci drzewa kubelka (pusty kubelek - 0 porownan). W stanie zamrozonym - dlugosc
+    // petli szukania w ukladzie Eytzingera.
+    bool probe_stats(ProbeStats& stats) const override {
+        stats = ProbeStats();
+        if (frozen) return frozen_probe_stats(stats);
+        if (table.empty()) return true;
+        double hit_total = 0;
+        double miss_total = 0;
+        for (const Bucket& bucket : table) {
+            if (bucket.generation != generation || !bucket.root) continue;
+            double bucket_miss = 0;
+            double bucket_externals = 0;
+            probe_depths_avl(bucket.root, 0, hit_total, bucket_miss, bucket_externals, stats.max_hit);
+            miss_total += bucket_miss / bucket_externals;
+        }
+        stats.average_hit = current_size ? hit_total / static_cast<double>(current_size) : 0.0;
+        stats.average_miss = miss_total / static_cast<double>(table_size);
+        return true;
+    }
+
+    // Dozwolony zakres: (0, LOAD_FACTOR_LIMIT].
+    bool set_max_load_factor(double value) override {
+        if (!(value > 0.0 && value <= LOAD_FACTOR_LIMIT)) return false;
+        max_load_factor = value;
+        while (!table.empty() && over_load_factor()) {
+            resize();
+        }
+        return true;
+    }
+
+    // Dozwolony zakres: (1, GROWTH_FACTOR_LIMIT].
+    bool set_growth_factor(double value) override {
+        if (!(value > 1.0 && value <= GROWTH_FACTOR_LIMIT)) return false;
+        growth_factor = value;
+        return true;
+    }
+
+    double get_max_load_factor() const override { return max_load_factor; }
+
+    double get_growth_factor() const override { return growth_factor; }
+
+    // Liczba rotacji od utworzenia tabeli (takze przy resize; podwojna rotacja liczy sie jako 2).
+    uint64_t rotation_count() const { return rotations; }
+
+    // Czyści tabele w czasie O(1): wszystkie wezly wracaja naraz do areny,
+    // a nowa generacja sprawia, ze stare korzenie czytaja sie jako puste.
+    void clear() override {
+        clear(false);
+    }
+
+    // Czyści tabele; przy 'release_storage' zwalnia tez pamiec areny i wektor korzeni.
+    void clear(bool release_storage) override {
+        if (frozen) {
+            frozen = false;
+            std::vector<FrozenEntry>().swap(frozen_entries);
+            std::vector<size_t>().swap(frozen_offsets);
+        }
+        if (release_storage) {
+            arena.release();
+            std::vector<Bucket>().swap(table); // Zwolnij wektor korzeni
+        }
+        else {
+            arena.reset();
+            if (++generation == 0) {
+                // Licznik generacji sie przekrecil - wyzeruj korzenie naprawde
+                for (Bucket& bucket : table) {
+                    bucket = Bucket();
+                }
+                generation = 1;
+            }
+        }
+        current_size = 0; // Zresetuj licznik elementow
+    }
+
+    // Zamienia drzewa wszystkich kubelkow na tablice w ukladzie Eytzingera i zwalnia wezly oraz
+    // wektor korzeni. Watki najpierw licza rozmiary drzew swoich kubelkow, potem (po sumach
+    // prefiksowych wyznaczajacych pozycje kubelkow) przepisuja drzewa inorder wprost na pozycje
+    // Eytzingera. Pusta (niezaalokowana) lub juz zamrozona tabela pozostaje bez zmian.
+    void freeze() {
+        if (frozen || table.empty()) return;
+        frozen_offsets.assign(table_size + 1, 0);
+        parallel_for_buckets([this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                frozen_offsets[i + 1] = count_avl(live_root(i));
+            }
+        });
+        for (size_t i = 0; i < table_size; ++i) {
+            frozen_offsets[i + 1] += frozen_offsets[i];
+        }
+        frozen_entries.resize(current_size);
+        parallel_for_buckets([this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                size_t count = frozen_offsets[i + 1] - frozen_offsets[i];
+                size_t position = eytzinger_first(count);
+                fill_eytzinger(live_root(i), frozen_entries.data() + frozen_offsets[i], count, position);
+            }
+        });
+        arena.release();
+        std::vector<Bucket>().swap(table);
+        frozen = true;
+    }
+
+    // Odtwarza drzewa AVL z zamrozonych tablic (kazde idealnie zbalansowane). Arena nie jest
+    // wielowatkowa, wiec wezly sa alokowane w biezacym watku (kolejne sloty areny); wypelnianie
+    // ich i laczenie w drzewa odbywa sie rownolegle po kubelkach.
+    void thaw() {
+        if (!frozen) return;
+        table.assign(table_size, Bucket());
+        std::vector<AVLNode*> nodes(current_size);
+        for (AVLNode*& node : nodes) {
+            node = arena.create(0, 0);
+        }
+        parallel_for_buckets([this, &nodes](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const FrozenEntry* entries = frozen_entries.data() + frozen_offsets[i];
+                size_t count = frozen_offsets[i + 1] - frozen_offsets[i];
+                if (count == 0) continue;
+                AVLNode** sorted = nodes.data() + frozen_offsets[i];
+                size_t next = 0;
+                for (size_t k = eytzinger_first(count); k; k = eytzinger_next(k, count)) {
+                    sorted[next]->key = entries[k - 1].key;
+                    sorted[next]->value = entries[k - 1].value;
+                    ++next;
+                }
+                table[i] = { build_balanced(sorted, count), generation };
+            }
+        });
+        frozen = false;
+        std::vector<FrozenEntry>().swap(frozen_entries);
+        std::vector<size_t>().swap(frozen_offsets);
+    }
+
+    // Czy tabela jest w stanie zamrozonym (po freeze(), przed thaw() lub zmiana zbioru kluczy).
+    bool is_frozen() const { return frozen; }
+
+    // Zwraca nazwe implementacji tabeli hashujacej.
+    std::string get_name() const override {
+        return "AVL Hash Table";
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h).
+inline const bool avl_hash_table_registered = register_engine({
+    "avl", "AVL", "AVL", 30, 48.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new AVLHashTable(n)); } });
+
+#endif // AVL_HASH_TABLE_H
@@ -0,0 +1,1341 @@
+#ifndef BENCHMARK_DRIVER_H
+#define BENCHMARK_DRIVER_H
+
+#include "hash_table_base.h" // Interfejs testowanych tabel
+#include "engine_registry.h" // Silniki rejestrowane przez naglowki implementacji
+#include "key_generator.h"   // Klucze wyliczane z indeksu, rozklady uniform/sequential/zipf
+#include "cpu_dispatch.h"    // Opis wybranych jader SIMD w raporcie
+#include "precision_timer.h" // Pomiar porcji operacji (rdtscp, odejmowanie kosztu pomiaru)
+#include "benchmark_stats.h" // Mediana, MAD, przedzialy ufnosci, porownanie z wynikami bazowymi
+#include "cache_control.h"   // Rozmiary cache i dostepna pamiec (zakres pamieci zbioru roboczego)
+#include "ycsb_workload.h"   // Mieszane obciazenia A-F
+#include "soak_benchmark.h"  // Dlugotrwala wymiana kluczy przy stalym rozmiarze tabeli
+#include "operation_trace.h" // Odtwarzanie nagranych operacji (mmap)
+#include <algorithm> // std::min_element
+#include <array>     // Czasy faz jednego watku
+#include <atomic>    // Wspolny start watkow
+#include <cmath>     // std::pow
+#include <cstdlib>   // std::strtod
+#include <fstream>   // Zapis wynikow do pliku
+#include <iomanip>   // Formatowanie tabeli wynikow
+#include <memory>    // std::unique_ptr
+#include <sstream>   // Dzielenie list argumentow
+#include <thread>    // Przebiegi wielowatkowe
+#include <vector>
+
+// Nieinteraktywny sterownik benchmarkow: wszystkie parametry przychodza z linii polecen,
+// wiec przebiegi (takze dla 10^9 kluczy) moga byc uruchamiane ze skryptow bez stdin.
+//
+//   ./hash_tables --engines=chaining,avl --ops=insert,find --sizes=1k,1M,1e9
+//                 --dist=uniform,zipf --threads=1,4 --reps=5 --warmup=1
+//                 --format=csv --output=wyniki.csv
+//
+// Dla kazdej kombinacji (silnik, rozmiar, rozklad, liczba watkow) kazdy watek buduje
+// wlasna tabele (tabele nie sa wspoldzielone - nie sa bezpieczne watkowo) i wykonuje
+// kolejno fazy: insert N kluczy, find N trafien, miss N chybien, remove N/2 kluczy.
+// Fazy spoza --ops sa wykonywane (insert jest potrzebny pozostalym), ale nie raportowane.
+// Wynik to czas na operacje w kazdym powtorzeniu oraz laczna przepustowosc wszystkich watkow;
+// raport podaje tez mediane powtorzen i jej 95% przedzial ufnosci (benchmark_stats.h).
+//
+// --sweep=1k:1G rozmiary rosnace geometrycznie (domyslnie x2) az do wielkosci, w ktorej
+// tabela nie miesci sie w zadnym cache. Kazdy wynik ma oznaczenie poziomu pamieci (L1/L2/L3/DRAM),
+// w ktorym miesci sie zbior roboczy (pamiec tabeli zmierzona przez memory_usage());
+// kombinacje, ktore wg przyblizonej pamieci na element z rejestru silnikow nie zmieszcza sie
+// w dostepnej pamieci RAM, sa pomijane.
+//
+// --load-factors=0.3:0.95:0.05 powtarza kazda kombinacje dla kolejnych maksymalnych wspolczynnikow
+// wypelnienia (HashTableBase::set_max_load_factor; silniki bez tej mozliwosci sa pomijane),
+// a --growth=1.5 zmienia krotnosc wzrostu tabel. Kazdy wynik podaje pamiec na element zmierzona
+// przez memory_usage() po fazie insert; tabela konczy sie wykresem Mops/s wzgledem bajtow na element.
+//
+// --ycsb=a,b,c,d,e,f zamiast faz uruchamia mieszane obciazenia YCSB (ycsb_workload.h): dla kazdego
+// silnika, liczby rekordow (--sizes) i sposobu wyboru rekordow (--dist) raportuje przepustowosc
+// w stanie ustalonym i percentyle opoznien pojedynczych operacji. Kazde obciazenie ma jeden watek.
+//
+// --soak=100M wykonuje tyle wymian kluczy (remove + insert nowego) przy stalym rozmiarze tabeli
+// (--sizes) i co --soak-interval wymian zapisuje przepustowosc, czasy wyszukiwan, statystyki
+// probkowania, pamiec tabeli i RSS procesu - krzywe degradacji w dlugim przebiegu (soak_benchmark.h).
+//
+// --replay=plik.htr odtwarza na kazdym silniku zapis operacji nagrany przez RecordingHashTable
+// (operation_trace.h, recording_hash_table.h) - wybor silnika na rzeczywistych wzorcach dostepu.
+// Kazde powtorzenie zaczyna od pustej tabeli; raport podaje czas na operacje i liczbe operacji,
+// ktorych wynik rozni sie od nagranego.
+//
+// --baseline=plik.csv porownuje wyniki z wczesniej zapisanym przebiegiem (--format=csv).
+// Istotne spowolnienie (mediana wolniejsza o wiecej niz --threshold i rozlaczne przedzialy
+// ufnosci) konczy program kodem 3 - tak mozna blokowac zmiany psujace wydajnosc.
+
+// Parametry przebiegu.
+struct BenchmarkOptions {
+    std::vector<std::string> engines = { "chaining", "open", "avl" };
+    std::vector<std::string> operations = { "insert", "find", "miss", "remove" };
+    std::vector<uint64_t> sizes = { 10000, 100000, 1000000 };
+    std::vector<KeyDistribution> distributions = { KeyDistribution::UNIFORM };
+    double zipf_exponent = 0.99;        // Wykladnik rozkladu Zipfa
+    std::vector<unsigned int> threads = { 1 };
+    int repetitions = 5;                // Mierzone powtorzenia
+    int warmup = 1;                     // Powtorzenia rozgrzewkowe (nie mierzone)
+    std::string format = "table";       // table, csv lub json
+    std::string output = "-";           // Plik wynikow; "-" oznacza standardowe wyjscie
+    uint64_t seed = 42;                 // Ziarno generatora (powtarzalne przebiegi)
+    std::string baseline;               // Plik CSV z wynikami bazowymi; pusty - bez porownania
+    double regression_threshold = 0.05; // Minimalne spowolnienie mediany zglaszane jako regresja
+    std::vector<double> load_factors;   // Maksymalne wspolczynniki wypelnienia; puste - domyslne silnikow
+    double growth_factor = 0;           // Krotnosc wzrostu tabel; 0 - domyslna silnikow
+    std::vector<YcsbWorkload> workloads; // Obciazenia YCSB; niepuste - uruchamiane zamiast faz
+    uint64_t ycsb_operations = 0;       // Operacje na przebieg YCSB; 0 - tyle, ile rekordow
+    uint64_t soak_operations = 0;       // Wymiany kluczy w tescie soak; niezerowe - uruchamiany zamiast faz
+    uint64_t soak_interval = 0;         // Wymiany miedzy probkami; 0 - 1/20 przebiegu
+    std::string replay;                 // Plik zapisu operacji; niepusty - odtwarzany zamiast faz
+};
+
+// Wynik jednej kombinacji parametrow dla jednej operacji.
+struct BenchmarkResult {
+    std::string engine;
+    std::string operation;
+    KeyDistribution distribution = KeyDistribution::UNIFORM;
+    uint64_t size = 0;
+    unsigned int threads = 1;
+    std::string regime;              // Poziom pamieci mieszczacy zbior roboczy (L1, L2, L3, DRAM)
+    double load_factor = 0;          // Ustawiony maksymalny wspolczynnik wypelnienia (0 - domyslny)
+    double growth_factor = 0;        // Ustawiona krotnosc wzrostu (0 - domyslna)
+    double bytes_per_entry = 0;      // memory_usage() / liczba elementow po fazie insert
+    std::vector<double> ns_per_op;   // Czas na operacje w kazdym powtorzeniu (najwolniejszy watek)
+    std::vector<double> mops;        // Laczna przepustowosc watkow w kazdym powtorzeniu (mln op/s)
+
+    double mean_ns() const {
+        double sum = 0;
+        for (double v : ns_per_op) sum += v;
+        return ns_per_op.empty() ? 0.0 : sum / ns_per_op.size();
+    }
+    double min_ns() const {
+        return ns_per_op.empty() ? 0.0 : *std::min_element(ns_per_op.begin(), ns_per_op.end());
+    }
+    double mean_mops() const {
+        double sum = 0;
+        for (double v : mops) sum += v;
+        return mops.empty() ? 0.0 : sum / mops.size();
+    }
+    // Mediana, MAD i przedzial ufnosci czasu na operacje.
+    SampleSummary summary() const { return summarize_samples(ns_per_op); }
+
+    // Identyfikator komorki do porownan z wynikami bazowymi; niedomyslne wspolczynniki sa jego czescia.
+    std::string cell() const {
+        return cell_id(engine + "," + operation + "," + key_distribution_name(distribution) + "," +
+                       std::to_string(size) + "," + std::to_string(threads), load_factor, growth_factor);
+    }
+
+    static std::string cell_id(const std::string& base, double load_factor, double growth_factor) {
+        std::string id = base;
+        if (load_factor > 0) id += ",lf=" + format_factor(load_factor);
+        if (growth_factor > 0) id += ",growth=" + format_factor(growth_factor);
+        return id;
+    }
+
+    // Wspolczynnik jako krotki tekst (np. "0.75"), taki sam przy zapisie i wczytaniu CSV.
+    static std::string format_factor(double value) {
+        std::ostringstream text;
+        text << value;
+        return text.str();
+    }
+};
+
+// Wynik bazowy wczytany z pliku CSV.
+struct BaselineEntry {
+    std::string cell;      // Jak BenchmarkResult::cell()
+    SampleSummary summary; // Uzywane sa median, ci_low i ci_high
+};
+
+class BenchmarkDriver {
+private:
+    static constexpr int OPERATION_COUNT = 4;
+    static constexpr const char* OPERATION_NAMES[OPERATION_COUNT] = { "insert", "find", "miss", "remove" };
+
+    // Liczba operacji w fazie i jej czas w nanosekundach.
+    struct PhaseTiming {
+        uint64_t operations = 0;
+        double nanoseconds = 0;
+    };
+
+    static std::vector<std::string> split(const std::string& text, char separator) {
+        std::vector<std::string> parts;
+        std::stringstream stream(text);
+        std::string part;
+        while (std::getline(stream, part, separator)) {
+            if (!part.empty()) parts.push_back(part);
+        }
+        return parts;
+    }
+
+    // Liczba zmiennoprzecinkowa zajmujaca caly tekst.
+    static bool parse_double(const std::string& text, double& value) {
+        if (text.empty()) return false;
+        char* end = nullptr;
+        value = std::strtod(text.c_str(), &end);
+        return end == text.c_str() + text.size();
+    }
+
+    // Liczba z opcjonalnym przyrostkiem: 1000, 10k, 1M, 1G, 1e9, 10^9.
+    static bool parse_count(const std::string& text, uint64_t& value) {
+        if (text.empty()) return false;
+        double multiplier = 1;
+        std::string number = text;
+        char suffix = text.back();
+        if (suffix == 'k' || suffix == 'K') multiplier = 1e3;
+        else if (suffix == 'm' || suffix == 'M') multiplier = 1e6;
+        else if (suffix == 'g' || suffix == 'G') multiplier = 1e9;
+        if (multiplier != 1) number.pop_back();
+
+        double parsed;
+        size_t caret = number.find('^');
+        if (caret != std::string::npos) {
+            double base, exponent;
+            if (!parse_double(number.substr(0, caret), base) || !parse_double(number.substr(caret + 1), exponent)) {
+                return false;
+            }
+            parsed = std::pow(base, exponent);
+        }
+        else if (!parse_double(number, parsed)) {
+            return false;
+        }
+        parsed *= multiplier;
+        if (parsed < 0 || parsed != std::floor(parsed) || parsed > 1.8e19) return false;
+        value = static_cast<uint64_t>(parsed);
+        return true;
+    }
+
+    static bool is_operation(const std::string& name) {
+        for (const char* op : OPERATION_NAMES) {
+            if (name == op) return true;
+        }
+        return false;
+    }
+
+    static bool wants(const BenchmarkOptions& options, const char* operation) {
+        for (const auto& op : options.operations) {
+            if (op == operation) return true;
+        }
+        return false;
+    }
+
+    // Krok permutacji indeksow 0..n-1 (i * step mod n): liczba wzglednie pierwsza z n.
+    static uint64_t permutation_step(uint64_t n) {
+        uint64_t step = n / 2 + n / 8 + 1;
+        auto gcd = [](uint64_t a, uint64_t b) { while (b) { uint64_t t = a % b; a = b; b = t; } return a; };
+        while (gcd(step, n) != 1) ++step;
+        return step % n; // Mniejszy od n, aby wystarczylo jedno odejmowanie przy przejsciu
+    }
+
+    // Indeks klucza dla i-tej operacji wyszukiwania.
+    static uint64_t pick_index(uint64_t i, uint64_t n, KeyDistribution distribution,
+                               SplitMix64& rng, const ZipfGenerator& zipf) {
+        switch (distribution) {
+        case KeyDistribution::SEQUENTIAL: return i;
+        case KeyDistribution::ZIPF: return zipf.next(rng);
+        default: return rng.below(n);
+        }
+    }
+
+    // Klucze sa generowane porcjami po KEY_CHUNK poza pomiarem czasu, a mierzona jest tylko
+    // petla operacji na tabeli - koszt generatora (np. exp/log w rozkladzie Zipfa) nie wchodzi
+    // do wyniku, a bufor porcji (16 KB) miesci sie w L1 niezaleznie od rozmiaru przebiegu.
+    static constexpr size_t KEY_CHUNK = 4096;
+
+    // Wykonuje 'operation' dla 'count' kluczy next_key(0..count); zwraca zmierzony czas w ns.
+    template <class NextKey, class Operation>
+    static double timed_in_chunks(uint64_t count, NextKey next_key, Operation operation) {
+        const PrecisionTimer& timer = precision_timer();
+        std::vector<int> keys(KEY_CHUNK);
+        double total_ns = 0;
+        for (uint64_t done = 0; done < count;) {
+            size_t chunk = static_cast<size_t>(std::min<uint64_t>(KEY_CHUNK, count - done));
+            for (size_t j = 0; j < chunk; ++j) {
+                keys[j] = next_key(done + j);
+            }
+            uint64_t start = timer.start();
+            for (size_t j = 0; j < chunk; ++j) {
+                operation(keys[j]);
+            }
+            uint64_t end = timer.stop();
+            total_ns += timer.elapsed_ns(start, end);
+            done += chunk;
+        }
+        return total_ns;
+    }
+
+    // Wszystkie fazy dla jednej tabeli (jeden watek, jedno powtorzenie).
+    // 'bytes_per_entry' dostaje pamiec tabeli na element po fazie insert.
+    // Z ustawionym wspolczynnikiem tabela ma od poczatku n / load_factor kubkow - po wstawieniu n kluczy
+    // jest wypelniona dokladnie w tym stopniu. Przy pojemnosci n rosnacej 2x wiele wspolczynnikow
+    // konczyloby sie ta sama potega dwojki, wiec wykres pamieci mialby tylko kilka punktow.
+    void run_phases(const std::string& engine, uint64_t n, KeyDistribution distribution,
+                    double zipf_exponent, double load_factor, double growth_factor, uint64_t seed,
+                    std::array<PhaseTiming, OPERATION_COUNT>& timings, double& bytes_per_entry) {
+        std::unique_ptr<HashTableBase> table = load_factor > 0
+            ? make_engine_for_load_factor(engine, static_cast<size_t>(n), load_factor)
+            : make_engine(engine, static_cast<size_t>(n));
+        if (load_factor > 0) table->set_max_load_factor(load_factor);
+        if (growth_factor > 0) table->set_growth_factor(growth_factor);
+        SplitMix64 rng(seed);
+        ZipfGenerator zipf(n, zipf_exponent);
+        long long sink = 0; // Zapobiega usunieciu wyszukiwan przez kompilator
+        auto hit_key = [&](uint64_t i) { return key_at(pick_index(i, n, distribution, rng, zipf), distribution); };
+        auto miss_key = [&](uint64_t i) { return key_at(n + pick_index(i, n, distribution, rng, zipf), distribution); };
+
+        timings[0] = { n, timed_in_chunks(n, [&](uint64_t i) { return key_at(i, distribution); },
+                                          [&](int key) { table->insert(key, key); }) };
+        bytes_per_entry = static_cast<double>(table->memory_usage()) / static_cast<double>(n);
+        timings[1] = { n, timed_in_chunks(n, hit_key, [&](int key) {
+            const int* value = table->find_ptr(key);
+            sink += value ? *value : 0;
+        }) };
+        timings[2] = { n, timed_in_chunks(n, miss_key, [&](int key) { sink += table->contains(key); }) };
+
+        // Usuwanie polowy kluczy w kolejnosci permutacji (dla SEQUENTIAL - rosnaco)
+        uint64_t step = distribution == KeyDistribution::SEQUENTIAL ? 1 : permutation_step(n);
+        uint64_t index = 0;
+        timings[3] = { n / 2, timed_in_chunks(n / 2, [&](uint64_t) {
+            int key = key_at(index, distribution);
+            index += step;
+            if (index >= n) index -= n;
+            return key;
+        }, [&](int key) { sink += table->remove(key); }) };
+        sink_value += sink;
+    }
+
+    std::atomic<long long> sink_value{ 0 };
+
+public:
+    // Nazwy zarejestrowanych silnikow (bez wariantow z dekoratorami).
+    static std::vector<std::string> engine_names() {
+        std::vector<std::string> names;
+        for (const auto& engine : EngineRegistry::instance().engines()) {
+            names.push_back(engine.name);
+        }
+        return names;
+    }
+
+    // Tworzy silnik o podanej nazwie, takze "dekorator-silnik", dla 'keys' kluczy przy jego
+    // domyslnym wspolczynniku wypelnienia (nullptr dla nieznanej nazwy).
+    static std::unique_ptr<HashTableBase> make_engine(const std::string& name, size_t keys) {
+        return EngineRegistry::instance().create(name, keys);
+    }
+
+    // Jak make_engine, ale z pojemnoscia keys / load_factor - po wstawieniu 'keys' kluczy tabela
+    // jest wypelniona w stopniu 'load_factor' (sam wspolczynnik ustawia wywolujacy).
+    static std::unique_ptr<HashTableBase> make_engine_for_load_factor(const std::string& name, size_t keys,
+                                                                      double load_factor) {
+        size_t capacity = static_cast<size_t>(std::ceil(static_cast<double>(keys) / load_factor));
+        return EngineRegistry::instance().create_with_capacity(name, capacity, keys);
+    }
+
+    static void print_usage(std::ostream& out) {
+        out << "Usage: hash_tables [options]   (no options: interactive menu)\n"
+            << "  --engines=LIST   engines to test (default chaining,open,avl); available:";
+        for (const auto& name : engine_names()) out << " " << name;
+        out << ";\n"
+            << "                   prefix with";
+        for (const auto& decorator : EngineRegistry::instance().decorators()) out << " " << decorator.name << "-";
+        out << " to wrap an engine (e.g. bloom-avl)\n"
+            << "  --ops=LIST       insert,find,miss,remove (default: all)\n"
+            << "  --sizes=LIST     key counts, e.g. 10k,1M,1e9,10^9 (default 10k,100k,1M)\n"
+            << "  --sweep=MIN:MAX[:FACTOR]  geometric sizes, e.g. 1k:1G (factor 2); sizes that do\n"
+            << "                   not fit in available memory are skipped\n"
+            << "  --dist=LIST      uniform,sequential,zipf (default uniform)\n"
+            << "  --zipf=S         Zipf exponent (default 0.99)\n"
+            << "  --threads=LIST   thread counts; each thread uses its own table (default 1)\n"
+            << "  --reps=N         measured repetitions (default 5)\n"
+            << "  --warmup=N       unmeasured warm-up repetitions (default 1)\n"
+            << "  --format=F       table, csv or json (default table)\n"
+            << "  --output=FILE    results file, - for stdout (default -)\n"
+            << "  --seed=N         random seed (default 42)\n"
+            << "  --baseline=FILE  compare with a CSV written by --format=csv; exit code 3 on regression\n"
+            << "  --threshold=PCT  minimum median slowdown reported as regression (default 5)\n"
+            << "  --load-factors=LIST|MIN:MAX:STEP  max load factors to sweep, e.g. 0.3:0.95:0.05;\n"
+            << "                   engines without a configurable load factor are skipped\n"
+            << "  --growth=F       table growth factor, e.g. 1.5 (default: engine's own, usually 2)\n"
+            << "  --ycsb=LIST      run YCSB workloads a-f (or all) instead of the phases; --sizes is the\n"
+            << "                   record count, --dist the record chooser (d always uses latest)\n"
+            << "  --ycsb-ops=N     operations per YCSB pass (default: record count)\n"
+            << "  --soak=N         soak test: N key replacements at constant table size (--sizes), --dist\n"
+            << "                   picks the replaced key (uniform random, sequential oldest, zipf hot)\n"
+            << "  --soak-interval=N  replacements between samples (default N/20)\n"
+            << "  --replay=FILE    replay a trace recorded by RecordingHashTable on each engine\n"
+            << "                   (--reps/--warmup apply, --sizes and --dist are ignored)\n"
+            << "  --help           show this help\n";
+    }
+
+    // Wypelnia 'options' na podstawie argumentow. Zwraca false i opis bledu w 'error'.
+    // Akceptowane sa formy --opcja=wartosc oraz --opcja wartosc.
+    static bool parse_args(int argc, char** argv, BenchmarkOptions& options, std::string& error) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                error.clear();
+                return false;
+            }
+            if (arg.compare(0, 2, "--") != 0) {
+                error = "unexpected argument: " + arg;
+                return false;
+            }
+            std::string name = arg.substr(2);
+            std::string value;
+            size_t equals = name.find('=');
+            if (equals != std::string::npos) {
+                value = name.substr(equals + 1);
+                name = name.substr(0, equals);
+            }
+            else if (i + 1 < argc) {
+                value = argv[++i];
+            }
+            else {
+                error = "missing value for --" + name;
+                return false;
+            }
+
+            if (!apply_option(options, name, value, error)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool apply_option(BenchmarkOptions& options, const std::string& name,
+                             const std::string& value, std::string& error) {
+        uint64_t number = 0;
+        if (name == "engines") {
+            options.engines = split(value, ',');
+            for (const auto& engine : options.engines) {
+                if (!make_engine(engine, 1)) {
+                    error = "unknown engine: " + engine;
+                    return false;
+                }
+            }
+        }
+        else if (name == "ops") {
+            options.operations = split(value, ',');
+            for (const auto& op : options.operations) {
+                if (!is_operation(op)) {
+                    error = "unknown operation: " + op;
+                    return false;
+                }
+            }
+        }
+        else if (name == "sizes") {
+            options.sizes.clear();
+            for (const auto& part : split(value, ',')) {
+                // Chybienia uzywaja kluczy o indeksach [n, 2n) z 32-bitowej przestrzeni kluczy
+                if (!parse_count(part, number) || number == 0 || number > (uint64_t{ 1 } << 31)) {
+                    error = "invalid size (1 .. 2^31): " + part;
+                    return false;
+                }
+                options.sizes.push_back(number);
+            }
+        }
+        else if (name == "sweep") {
+            std::vector<std::string> parts = split(value, ':');
+            uint64_t min_size = 0;
+            uint64_t max_size = 0;
+            double factor = 2;
+            if (parts.size() < 2 || parts.size() > 3 || !parse_count(parts[0], min_size) ||
+                !parse_count(parts[1], max_size) || (parts.size() == 3 && !parse_double(parts[2], factor)) ||
+                min_size == 0 || max_size < min_size || max_size > (uint64_t{ 1 } << 31) || factor <= 1) {
+                error = "invalid sweep (MIN:MAX[:FACTOR], 1 <= MIN <= MAX <= 2^31, FACTOR > 1): " + value;
+                return false;
+            }
+            options.sizes.clear();
+            for (double size = static_cast<double>(min_size); size <= max_size * (1 + 1e-9); size *= factor) {
+                uint64_t rounded = static_cast<uint64_t>(size + 0.5);
+                if (options.sizes.empty() || rounded != options.sizes.back()) {
+                    options.sizes.push_back(rounded);
+                }
+            }
+        }
+        else if (name == "dist") {
+            options.distributions.clear();
+            for (const auto& part : split(value, ',')) {
+                KeyDistribution distribution;
+                if (!parse_key_distribution(part, distribution)) {
+                    error = "unknown distribution: " + part;
+                    return false;
+                }
+                options.distributions.push_back(distribution);
+            }
+        }
+        else if (name == "zipf") {
+            if (!parse_double(value, options.zipf_exponent) || options.zipf_exponent <= 0) {
+                error = "invalid Zipf exponent: " + value;
+                return false;
+            }
+        }
+        else if (name == "threads") {
+            options.threads.clear();
+            for (const auto& part : split(value, ',')) {
+                if (!parse_count(part, number) || number == 0 || number > 1024) {
+                    error = "invalid thread count: " + part;
+                    return false;
+                }
+                options.threads.push_back(static_cast<unsigned int>(number));
+            }
+        }
+        else if (name == "reps" || name == "warmup") {
+            if (!parse_count(value, number) || number > 1000000 || (name == "reps" && number == 0)) {
+                error = "invalid value for --" + name + ": " + value;
+                return false;
+            }
+            if (name == "reps") options.repetitions = static_cast<int>(number);
+            else options.warmup = static_cast<int>(number);
+        }
+        else if (name == "format") {
+            if (value != "table" && value != "csv" && value != "json") {
+                error = "unknown format: " + value;
+                return false;
+            }
+            options.format = value;
+        }
+        else if (name == "output") {
+            options.output = value;
+        }
+        else if (name == "baseline") {
+            options.baseline = value;
+        }
+        else if (name == "threshold") {
+            double percent;
+            if (!parse_double(value, percent) || percent < 0) {
+                error = "invalid threshold: " + value;
+                return false;
+            }
+            options.regression_threshold = percent / 100;
+        }
+        else if (name == "load-factors") {
+            options.load_factors.clear();
+            std::vector<std::string> range = split(value, ':');
+            double first, last, step;
+            if (range.size() == 3) {
+                if (!parse_double(range[0], first) || !parse_double(range[1], last) || !parse_double(range[2], step) ||
+                    first <= 0 || last < first || step <= 0) {
+                    error = "invalid load factor range (MIN:MAX:STEP): " + value;
+                    return false;
+                }
+                // Wartosci liczone od poczatku (nie sumowane), aby nie kumulowac bledu zaokraglen
+                for (int i = 0; first + i * step <= last + 1e-9; ++i) {
+                    options.load_factors.push_back(std::round((first + i * step) * 1e6) / 1e6);
+                }
+            }
+            else {
+                for (const auto& part : split(value, ',')) {
+                    double factor;
+                    if (!parse_double(part, factor) || factor <= 0) {
+                        error = "invalid load factor: " + part;
+                        return false;
+                    }
+                    options.load_factors.push_back(factor);
+                }
+            }
+            if (options.load_factors.empty()) {
+                error = "empty list for --" + name;
+                return false;
+            }
+        }
+        else if (name == "growth") {
+            if (!parse_double(value, options.growth_factor) || options.growth_factor <= 1) {
+                error = "invalid growth factor (> 1): " + value;
+                return false;
+            }
+        }
+        else if (name == "ycsb") {
+            options.workloads.clear();
+            for (const auto& part : split(value == "all" ? "a,b,c,d,e,f" : value, ',')) {
+                YcsbWorkload workload;
+                if (!parse_ycsb_workload(part, workload)) {
+                    error = "unknown YCSB workload: " + part;
+                    return false;
+                }
+                options.workloads.push_back(workload);
+            }
+            if (options.workloads.empty()) {
+                error = "empty list for --" + name;
+                return false;
+            }
+        }
+        else if (name == "ycsb-ops") {
+            if (!parse_count(value, number) || number == 0 || number > (uint64_t{ 1 } << 31)) {
+                error = "invalid YCSB operation count: " + value;
+                return false;
+            }
+            options.ycsb_operations = number;
+        }
+        else if (name == "soak" || name == "soak-interval") {
+            if (!parse_count(value, number) || number == 0 || number > (uint64_t{ 1 } << 32)) {
+                error = "invalid value for --" + name + ": " + value;
+                return false;
+            }
+            if (name == "soak") options.soak_operations = number;
+            else options.soak_interval = number;
+        }
+        else if (name == "replay") {
+            options.replay = value;
+        }
+        else if (name == "seed") {
+            if (!parse_count(value, number)) {
+                error = "invalid seed: " + value;
+                return false;
+            }
+            options.seed = number;
+        }
+        else {
+            error = "unknown option: --" + name;
+            return false;
+        }
+        if (options.engines.empty() || options.operations.empty() || options.sizes.empty() ||
+            options.distributions.empty() || options.threads.empty()) {
+            error = "empty list for --" + name;
+            return false;
+        }
+        return true;
+    }
+
+    // Wykonuje wszystkie kombinacje parametrow; postep trafia na std::cerr.
+    std::vector<BenchmarkResult> run(const BenchmarkOptions& options) {
+        std::vector<BenchmarkResult> results;
+        std::cerr << "Timer: " << precision_timer().description() << std::endl; // Kalibracja przed watkami pomiarowymi
+        std::cerr << "Memory: " << memory_description() << std::endl;
+        const uint64_t available = available_memory_bytes();
+        // 0 - domyslny wspolczynnik silnika (bez przegladu wspolczynnikow)
+        std::vector<double> load_factors = options.load_factors.empty() ? std::vector<double>{ 0.0 } : options.load_factors;
+        for (const auto& engine : options.engines) {
+            if (options.growth_factor > 0 && !make_engine(engine, 1)->set_growth_factor(options.growth_factor)) {
+                std::cerr << "Skipping " << engine << ": growth factor " << options.growth_factor
+                          << " not supported" << std::endl;
+                continue;
+            }
+            for (double load_factor : load_factors) {
+                if (load_factor > 0 && !make_engine(engine, 1)->set_max_load_factor(load_factor)) {
+                    std::cerr << "Skipping " << engine << ": load factor " << load_factor
+                              << " not supported" << std::endl;
+                    continue;
+                }
+                for (uint64_t size : options.sizes) {
+                    for (KeyDistribution distribution : options.distributions) {
+                        for (unsigned int thread_count : options.threads) {
+                            // Kazdy watek ma wlasna tabele; zostaw zapas na system i bufory
+                            double needed = working_set_bytes(engine, size) * thread_count;
+                            if (available && needed > available * MEMORY_LIMIT_FRACTION) {
+                                std::cerr << "Skipping " << engine << ", size " << size << ", " << thread_count
+                                          << " thread(s): needs ~" << format_bytes(needed) << ", available "
+                                          << format_bytes(static_cast<double>(available)) << std::endl;
+                                continue;
+                            }
+                            std::cerr << "Running " << engine << ", size " << size << ", "
+                                      << key_distribution_name(distribution) << ", " << thread_count << " thread(s)";
+                            if (load_factor > 0) std::cerr << ", load factor " << load_factor;
+                            std::cerr << std::endl;
+                            run_combination(options, engine, size, distribution, thread_count, load_factor, results);
+                        }
+                    }
+                }
+            }
+        }
+        return results;
+    }
+
+    static constexpr double MEMORY_LIMIT_FRACTION = 0.8; // Czesc dostepnej pamieci, ktora moga zajac tabele
+
+    // Przyblizony rozmiar jednej tabeli z 'size' elementami.
+    static double working_set_bytes(const std::string& engine, uint64_t size) {
+        return EngineRegistry::instance().bytes_per_entry(engine) * static_cast<double>(size);
+    }
+
+    // Poziom pamieci dla kombinacji: L1 i L2 sa prywatne dla rdzenia (liczy sie jedna tabela),
+    // L3 jest wspolny (licza sie tabele wszystkich watkow).
+    static const char* regime_of(double table_bytes, unsigned int thread_count) {
+        static const CacheInfo caches = detect_cache_info();
+        MemoryRegime regime = memory_regime(static_cast<uint64_t>(table_bytes), caches);
+        if (regime == MemoryRegime::L3 && caches.l3 && table_bytes * thread_count > caches.l3) {
+            regime = MemoryRegime::DRAM;
+        }
+        return memory_regime_name(regime);
+    }
+
+    // Szerokosc kolumny silnika w tabelach wynikow: najdluzsza nazwa plus spacja, co najmniej
+    // 'minimum' - nazwy z rejestru (np. "bloom-transpose-chaining") bywaja dluzsze niz naglowek.
+    template <typename Result>
+    static int engine_column_width(const std::vector<Result>& results, size_t minimum) {
+        size_t width = minimum;
+        for (const auto& r : results) width = std::max(width, r.engine.size() + 1);
+        return static_cast<int>(width);
+    }
+
+    static std::string format_bytes(double bytes) {
+        static const char* units[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+        int unit = 0;
+        while (bytes >= 1024 && unit < 4) {
+            bytes /= 1024;
+            ++unit;
+        }
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(unit ? 1 : 0) << bytes << " " << units[unit];
+        return text.str();
+    }
+
+    // Rozmiary cache i dostepna pamiec do naglowka raportu.
+    static std::string memory_description() {
+        CacheInfo caches = detect_cache_info();
+        return "L1d " + format_bytes(static_cast<double>(caches.l1d)) + ", L2 " + format_bytes(static_cast<double>(caches.l2)) +
+               ", L3 " + format_bytes(static_cast<double>(caches.l3)) + ", available RAM " +
+               format_bytes(static_cast<double>(available_memory_bytes()));
+    }
+
+    // Jedna kombinacja: rozgrzewka, potem 'repetitions' mierzonych powtorzen.
+    // Poziom pamieci jest oznaczany wg pamieci zmierzonej przez memory_usage() (szacunek z rejestru
+    // sluzy tylko do pominiecia kombinacji przed pomiarem).
+    void run_combination(const BenchmarkOptions& options, const std::string& engine, uint64_t size,
+                         KeyDistribution distribution, unsigned int thread_count, double load_factor,
+                         std::vector<BenchmarkResult>& results) {
+        size_t first = results.size();
+        for (const char* op : OPERATION_NAMES) {
+            if (!wants(options, op)) continue;
+            BenchmarkResult result;
+            result.engine = engine;
+            result.operation = op;
+            result.distribution = distribution;
+            result.size = size;
+            result.threads = thread_count;
+            result.load_factor = load_factor;
+            result.growth_factor = options.growth_factor;
+            results.push_back(result);
+        }
+
+        for (int rep = -options.warmup; rep < options.repetitions; ++rep) {
+            std::vector<std::array<PhaseTiming, OPERATION_COUNT>> timings(thread_count);
+            std::vector<double> bytes_per_entry(thread_count);
+            uint64_t rep_seed = options.seed + static_cast<uint64_t>(rep + options.warmup) * 7919;
+            if (thread_count == 1) {
+                run_phases(engine, size, distribution, options.zipf_exponent, load_factor, options.growth_factor,
+                           rep_seed, timings[0], bytes_per_entry[0]);
+            }
+            else {
+                // Watki czekaja na wspolny start, aby fazy wszystkich tabel nakladaly sie w czasie
+                std::atomic<unsigned int> ready{ 0 };
+                std::vector<std::thread> workers;
+                for (unsigned int t = 0; t < thread_count; ++t) {
+                    workers.emplace_back([&, t] {
+                        ready++;
+                        while (ready.load() < thread_count) std::this_thread::yield();
+                        run_phases(engine, size, distribution, options.zipf_exponent, load_factor,
+                                   options.growth_factor, rep_seed + t * 104729, timings[t], bytes_per_entry[t]);
+                    });
+                }
+                for (auto& worker : workers) worker.join();
+            }
+            if (rep < 0) continue; // Rozgrzewka
+
+            for (size_t slot = first; slot < results.size(); ++slot) {
+                results[slot].bytes_per_entry = bytes_per_entry[0];
+                results[slot].regime = regime_of(bytes_per_entry[0] * static_cast<double>(size), thread_count);
+            }
+            size_t slot = first;
+            for (int op = 0; op < OPERATION_COUNT; ++op) {
+                if (!wants(options, OPERATION_NAMES[op])) continue;
+                double slowest_ns = 0;
+                double total_ops_per_ns = 0;
+                for (const auto& thread_timings : timings) {
+                    const PhaseTiming& phase = thread_timings[op];
+                    double ns_per_op = phase.operations ? phase.nanoseconds / phase.operations : 0.0;
+                    slowest_ns = std::max(slowest_ns, ns_per_op);
+                    total_ops_per_ns += phase.nanoseconds > 0 ? phase.operations / phase.nanoseconds : 0.0;
+                }
+                results[slot].ns_per_op.push_back(slowest_ns);
+                results[slot].mops.push_back(total_ops_per_ns * 1e3);
+                ++slot;
+            }
+        }
+    }
+
+    // Obciazenia YCSB dla wszystkich kombinacji (silnik, obciazenie, rekordy, wybor rekordow).
+    // Obciazenie D zawsze wybiera najnowsze rekordy, wiec jest wykonywane raz, niezaleznie od --dist.
+    std::vector<YcsbResult> run_ycsb(const BenchmarkOptions& options) {
+        std::vector<YcsbResult> results;
+        std::cerr << "Timer: " << precision_timer().description() << std::endl;
+        std::cerr << "Memory: " << memory_description() << std::endl;
+        const uint64_t available = available_memory_bytes();
+        long long sink = 0;
+        for (const auto& engine : options.engines) {
+            for (YcsbWorkload workload : options.workloads) {
+                for (uint64_t records : options.sizes) {
+                    uint64_t operations = options.ycsb_operations ? options.ycsb_operations : records;
+                    double needed = working_set_bytes(engine, records + operations); // D i E wstawiaja rekordy
+                    if (available && needed > available * MEMORY_LIMIT_FRACTION) {
+                        std::cerr << "Skipping " << engine << ", " << records << " records: needs ~"
+                                  << format_bytes(needed) << std::endl;
+                        continue;
+                    }
+                    for (KeyDistribution chooser : options.distributions) {
+                        bool latest = ycsb_mix(workload).latest;
+                        if (latest && chooser != options.distributions.front()) continue;
+                        YcsbResult result;
+                        result.engine = engine;
+                        result.workload = workload;
+                        result.chooser = latest ? "latest" : key_distribution_name(chooser);
+                        result.records = records;
+                        result.operations = operations;
+                        std::cerr << "Running YCSB " << ycsb_workload_name(workload) << " on " << engine << ", "
+                                  << records << " records, " << result.chooser << std::endl;
+                        for (int rep = -options.warmup; rep < options.repetitions; ++rep) {
+                            std::unique_ptr<HashTableBase> table = make_engine(engine, static_cast<size_t>(records));
+                            if (options.growth_factor > 0) table->set_growth_factor(options.growth_factor);
+                            uint64_t rep_seed = options.seed + static_cast<uint64_t>(rep + options.warmup) * 7919;
+                            std::vector<float> latencies;
+                            latencies.reserve(static_cast<size_t>(operations));
+                            double ns_per_op = run_ycsb_repetition(*table, workload, chooser, records, operations,
+                                                                   options.zipf_exponent, rep_seed, latencies, sink);
+                            if (rep < 0) continue; // Rozgrzewka
+                            result.ns_per_op.push_back(ns_per_op);
+                            result.latencies.insert(result.latencies.end(), latencies.begin(), latencies.end());
+                        }
+                        result.sort_latencies();
+                        results.push_back(std::move(result));
+                    }
+                }
+            }
+        }
+        sink_value += sink;
+        return results;
+    }
+
+    // Test soak dla kazdej kombinacji (silnik, rozmiar, wybor usuwanego klucza); probki na biezaco na std::cerr.
+    // Przed kazdym silnikiem wolna pamiec sterty wraca do systemu, aby RSS nie zawieral
+    // pozostalosci po poprzednim (dla pewnosci mozna uruchamiac jeden silnik na proces).
+    std::vector<SoakResult> run_soak(const BenchmarkOptions& options) {
+        std::vector<SoakResult> results;
+        std::cerr << "Timer: " << precision_timer().description() << std::endl;
+        std::cerr << "Memory: " << memory_description() << std::endl;
+        const uint64_t available = available_memory_bytes();
+        const uint64_t operations = options.soak_operations;
+        const uint64_t interval = options.soak_interval ? options.soak_interval : std::max<uint64_t>(1, operations / 20);
+        for (const auto& engine : options.engines) {
+            for (uint64_t size : options.sizes) {
+                double needed = working_set_bytes(engine, size) + size * sizeof(uint32_t);
+                if (size + operations > SoakBenchmark::MAX_INDEX) {
+                    std::cerr << "Skipping " << engine << ", size " << size << ": size + replacements exceed "
+                              << SoakBenchmark::MAX_INDEX << " distinct keys" << std::endl;
+                    continue;
+                }
+                if (available && needed > available * MEMORY_LIMIT_FRACTION) {
+                    std::cerr << "Skipping " << engine << ", size " << size << ": needs ~" << format_bytes(needed) << std::endl;
+                    continue;
+                }
+                for (KeyDistribution distribution : options.distributions) {
+                    release_free_heap();
+                    std::unique_ptr<HashTableBase> table = make_engine(engine, static_cast<size_t>(size));
+                    if (options.growth_factor > 0) table->set_growth_factor(options.growth_factor);
+                    SoakResult result;
+                    result.engine = engine;
+                    std::cerr << "Soak " << engine << ", size " << size << ", " << key_distribution_name(distribution)
+                              << ", " << operations << " replacements" << std::endl;
+                    SoakBenchmark soak(*table, size, distribution, options.zipf_exponent, options.seed);
+                    soak.run(operations, interval, result, [](const SoakSample& sample) {
+                        std::cerr << "  " << std::setw(12) << sample.operations << " ops  " << std::fixed
+                                  << std::setprecision(2) << std::setw(8) << sample.replace_mops << " Mrepl/s  find "
+                                  << sample.find_ns << " ns  miss " << sample.miss_ns << " ns  probes "
+                                  << sample.probes.average_hit << "/" << sample.probes.average_miss << "  RSS "
+                                  << format_bytes(static_cast<double>(sample.rss_bytes)) << std::defaultfloat << std::endl;
+                    });
+                    sink_value += soak.checksum();
+                    results.push_back(std::move(result));
+                }
+            }
+        }
+        return results;
+    }
+
+    // Odtwarza zapis operacji na kazdym silniku. Tabela ma wstepny rozmiar rowny najwiekszej
+    // liczbie elementow z zapisu; kazde powtorzenie (takze rozgrzewkowe) zaczyna od pustej tabeli.
+    // Zwraca false i opis bledu w 'error', gdy pliku nie da sie odczytac.
+    bool run_replay(const BenchmarkOptions& options, std::vector<TraceReplayResult>& results, std::string& error) {
+        MappedTrace trace;
+        if (!trace.open(options.replay, error)) {
+            return false;
+        }
+        std::cerr << "Timer: " << precision_timer().description() << std::endl;
+        std::cerr << "Memory: " << memory_description() << std::endl;
+        std::cerr << "Trace: " << trace_description(trace) << std::endl;
+        const PrecisionTimer& timer = precision_timer();
+        const size_t capacity = static_cast<size_t>(std::max<uint64_t>(trace.peak_size(), 16));
+        long long sink = 0;
+        for (const auto& engine : options.engines) {
+            TraceReplayResult result;
+            result.engine = engine;
+            result.records = trace.size();
+            std::cerr << "Replaying on " << engine << std::endl;
+            for (int rep = -options.warmup; rep < options.repetitions; ++rep) {
+                std::unique_ptr<HashTableBase> table = make_engine(engine, capacity);
+                if (options.growth_factor > 0) table->set_growth_factor(options.growth_factor);
+                uint64_t start = timer.start();
+                uint64_t mismatches = replay_trace(*table, trace.records(), trace.size(), sink);
+                double ns = timer.elapsed_ns(start, timer.stop());
+                if (rep == -options.warmup) {
+                    result.mismatches = mismatches;
+                    result.table_bytes = table->memory_usage();
+                }
+                if (rep < 0) continue; // Rozgrzewka
+                result.ns_per_op.push_back(trace.size() ? ns / static_cast<double>(trace.size()) : 0.0);
+            }
+            if (result.mismatches) {
+                std::cerr << "Warning: " << engine << " returned " << result.mismatches
+                          << " results different from the recording" << std::endl;
+            }
+            results.push_back(std::move(result));
+        }
+        sink_value += sink;
+        return true;
+    }
+
+    // Liczba rekordow, udzialy operacji i najwiekszy rozmiar tabeli w zapisie.
+    static std::string trace_description(const MappedTrace& trace) {
+        std::ostringstream text;
+        text << trace.size() << " operations (";
+        for (int op = 0; op < 4; ++op) {
+            TraceOperation operation = static_cast<TraceOperation>(op);
+            double share = trace.size() ? 100.0 * trace.count(operation) / trace.size() : 0.0;
+            text << (op ? ", " : "") << trace_operation_name(operation) << " " << std::fixed << std::setprecision(1)
+                 << share << "%";
+        }
+        text << "), peak size " << trace.peak_size();
+        return text.str();
+    }
+
+    // Zapisuje wyniki odtwarzania w wybranym formacie.
+    static void write_replay_results(std::ostream& out, const std::string& format, const std::string& trace_path,
+                                     const std::vector<TraceReplayResult>& results) {
+        if (format == "csv") {
+            out << "engine,trace,records,reps,mops,median_ns_per_op,ci_low_ns,ci_high_ns,mismatches,table_bytes\n";
+            for (const auto& r : results) {
+                SampleSummary stats = r.summary();
+                out << r.engine << "," << trace_path << "," << r.records << "," << r.ns_per_op.size() << ","
+                    << r.mops() << "," << stats.median << "," << stats.ci_low << "," << stats.ci_high << ","
+                    << r.mismatches << "," << r.table_bytes << "\n";
+            }
+        }
+        else if (format == "json") {
+            out << "{\n  \"timer\": \"" << precision_timer().description() << "\",\n"
+                << "  \"memory\": \"" << memory_description() << "\",\n  \"trace\": \"" << trace_path
+                << "\",\n  \"replay\": [\n";
+            for (size_t i = 0; i < results.size(); ++i) {
+                const auto& r = results[i];
+                SampleSummary stats = r.summary();
+                out << "    {\"engine\": \"" << r.engine << "\", \"records\": " << r.records << ", \"mops\": "
+                    << r.mops() << ", \"median_ns_per_op\": " << stats.median << ", \"ci95_ns\": [" << stats.ci_low
+                    << ", " << stats.ci_high << "], \"mismatches\": " << r.mismatches << ", \"table_bytes\": "
+                    << r.table_bytes << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+            }
+            out << "  ]\n}\n";
+        }
+        else {
+            out << "Timer: " << precision_timer().description() << "\n";
+            out << "Memory: " << memory_description() << "\n";
+            out << "Trace: " << trace_path << "\n";
+            const int engine_width = engine_column_width(results, 22);
+            out << std::left << std::setw(engine_width) << "engine" << std::right << std::setw(14) << "operations"
+                << std::setw(10) << "Mops/s" << std::setw(10) << "ns/op" << std::setw(22) << "95% CI"
+                << std::setw(12) << "mismatch" << std::setw(12) << "table" << "\n";
+            out << std::fixed << std::setprecision(2);
+            for (const auto& r : results) {
+                SampleSummary stats = r.summary();
+                std::ostringstream interval;
+                interval << std::fixed << std::setprecision(2) << stats.ci_low << " - " << stats.ci_high;
+                out << std::left << std::setw(engine_width) << r.engine << std::right << std::setw(14) << r.records
+                    << std::setw(10) << r.mops() << std::setw(10) << stats.median << std::setw(22) << interval.str()
+                    << std::setw(12) << r.mismatches << std::setw(12)
+                    << format_bytes(static_cast<double>(r.table_bytes)) << "\n";
+            }
+            out << std::defaultfloat;
+        }
+    }
+
+    // Zapisuje probki testu soak; kolumny probe_* sa puste, gdy silnik nie udostepnia statystyk.
+    static void write_soak_results(std::ostream& out, const std::string& format, const std::vector<SoakResult>& results) {
+        auto probe = [](const SoakSample& sample, double value) {
+            std::ostringstream text;
+            if (sample.has_probe_stats) text << value;
+            return text.str();
+        };
+        if (format == "csv") {
+            out << "engine,size,distribution,operations,replace_mops,find_ns,miss_ns,probe_hit_avg,probe_miss_avg,"
+                << "probe_hit_max,tombstones,table_bytes,rss_bytes\n";
+            for (const auto& r : results) {
+                for (const auto& sample : r.samples) {
+                    out << r.engine << "," << r.size << "," << key_distribution_name(r.distribution) << ","
+                        << sample.operations << "," << sample.replace_mops << "," << sample.find_ns << ","
+                        << sample.miss_ns << "," << probe(sample, sample.probes.average_hit) << ","
+                        << probe(sample, sample.probes.average_miss) << ","
+                        << probe(sample, static_cast<double>(sample.probes.max_hit)) << ","
+                        << probe(sample, static_cast<double>(sample.probes.tombstones)) << ","
+                        << sample.table_bytes << "," << sample.rss_bytes << "\n";
+                }
+            }
+        }
+        else if (format == "json") {
+            out << "{\n  \"timer\": \"" << precision_timer().description() << "\",\n"
+                << "  \"memory\": \"" << memory_description() << "\",\n  \"soak\": [\n";
+            for (size_t i = 0; i < results.size(); ++i) {
+                const auto& r = results[i];
+                out << "    {\"engine\": \"" << r.engine << "\", \"size\": " << r.size << ", \"distribution\": \""
+                    << key_distribution_name(r.distribution) << "\", \"operations\": " << r.operations
+                    << ", \"samples\": [\n";
+                for (size_t j = 0; j < r.samples.size(); ++j) {
+                    const auto& sample = r.samples[j];
+                    out << "      {\"operations\": " << sample.operations << ", \"replace_mops\": " << sample.replace_mops
+                        << ", \"find_ns\": " << sample.find_ns << ", \"miss_ns\": " << sample.miss_ns;
+                    if (sample.has_probe_stats) {
+                        out << ", \"probe_hit_avg\": " << sample.probes.average_hit << ", \"probe_miss_avg\": "
+                            << sample.probes.average_miss << ", \"probe_hit_max\": " << sample.probes.max_hit
+                            << ", \"tombstones\": " << sample.probes.tombstones;
+                    }
+                    out << ", \"table_bytes\": " << sample.table_bytes << ", \"rss_bytes\": " << sample.rss_bytes << "}"
+                        << (j + 1 < r.samples.size() ? "," : "") << "\n";
+                }
+                out << "    ]}" << (i + 1 < results.size() ? "," : "") << "\n";
+            }
+            out << "  ]\n}\n";
+        }
+        else {
+            out << "Timer: " << precision_timer().description() << "\n";
+            out << "Memory: " << memory_description() << "\n";
+            for (const auto& r : results) {
+                out << "\n" << r.engine << ", size " << r.size << ", " << key_distribution_name(r.distribution) << ", "
+                    << r.operations << " replacements:\n";
+                out << std::right << std::setw(14) << "replacements" << std::setw(10) << "Mrepl/s" << std::setw(10)
+                    << "find ns" << std::setw(10) << "miss ns" << std::setw(10) << "hit avg" << std::setw(10)
+                    << "miss avg" << std::setw(9) << "hit max" << std::setw(12) << "deleted" << std::setw(12)
+                    << "table" << std::setw(12) << "RSS" << "\n";
+                out << std::fixed << std::setprecision(2);
+                for (const auto& sample : r.samples) {
+                    out << std::setw(14) << sample.operations << std::setw(10) << sample.replace_mops << std::setw(10)
+                        << sample.find_ns << std::setw(10) << sample.miss_ns << std::setw(10)
+                        << probe(sample, sample.probes.average_hit) << std::setw(10)
+                        << probe(sample, sample.probes.average_miss) << std::setw(9)
+                        << probe(sample, static_cast<double>(sample.probes.max_hit)) << std::setw(12)
+                        << probe(sample, static_cast<double>(sample.probes.tombstones)) << std::setw(12)
+                        << format_bytes(static_cast<double>(sample.table_bytes)) << std::setw(12)
+                        << format_bytes(static_cast<double>(sample.rss_bytes)) << "\n";
+                }
+                out << std::defaultfloat;
+            }
+        }
+    }
+
+    // Zapisuje wyniki YCSB w wybranym formacie (percentyle opoznien w ns).
+    static void write_ycsb_results(std::ostream& out, const std::string& format, const std::vector<YcsbResult>& results) {
+        static const double percents[] = { 50, 90, 99, 99.9 };
+        if (format == "csv") {
+            out << "engine,workload,chooser,records,operations,reps,mops,median_ns_per_op,ci_low_ns,ci_high_ns,"
+                << "p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n";
+            for (const auto& r : results) {
+                SampleSummary stats = r.summary();
+                out << r.engine << "," << ycsb_workload_name(r.workload) << "," << r.chooser << "," << r.records << ","
+                    << r.operations << "," << r.ns_per_op.size() << "," << r.mops() << "," << stats.median << ","
+                    << stats.ci_low << "," << stats.ci_high;
+                for (double percent : percents) out << "," << r.latency_percentile(percent);
+                out << "," << r.latency_percentile(100) << "\n";
+            }
+        }
+        else if (format == "json") {
+            out << "{\n  \"timer\": \"" << precision_timer().description() << "\",\n"
+                << "  \"memory\": \"" << memory_description() << "\",\n  \"ycsb\": [\n";
+            for (size_t i = 0; i < results.size(); ++i) {
+                const auto& r = results[i];
+                SampleSummary stats = r.summary();
+                out << "    {\"engine\": \"" << r.engine << "\", \"workload\": \"" << ycsb_workload_name(r.workload)
+                    << "\", \"chooser\": \"" << r.chooser << "\", \"records\": " << r.records
+                    << ", \"operations\": " << r.operations << ", \"mops\": " << r.mops()
+                    << ", \"median_ns_per_op\": " << stats.median << ", \"ci95_ns\": [" << stats.ci_low << ", "
+                    << stats.ci_high << "], \"latency_ns\": {\"p50\": " << r.latency_percentile(50)
+                    << ", \"p90\": " << r.latency_percentile(90) << ", \"p99\": " << r.latency_percentile(99)
+                    << ", \"p999\": " << r.latency_percentile(99.9) << ", \"max\": " << r.latency_percentile(100)
+                    << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+            }
+            out << "  ]\n}\n";
+        }
+        else {
+            out << "Timer: " << precision_timer().description() << "\n";
+            out << "Memory: " << memory_description() << "\n";
+            out << "YCSB workloads:";
+            for (int w = 0; w < 6; ++w) {
+                YcsbWorkload workload = static_cast<YcsbWorkload>(w);
+                out << (w ? "; " : " ") << ycsb_workload_name(workload) << " = " << ycsb_workload_description(workload);
+            }
+            out << "\n";
+            const int engine_width = engine_column_width(results, 18);
+            out << std::left << std::setw(engine_width) << "engine" << std::setw(4) << "wl" << std::setw(12) << "chooser"
+                << std::right << std::setw(12) << "records" << std::setw(10) << "Mops/s" << std::setw(10) << "ns/op"
+                << std::setw(22) << "95% CI" << std::setw(10) << "p50" << std::setw(10) << "p90"
+                << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(12) << "max" << "\n";
+            out << std::fixed << std::setprecision(2);
+            for (const auto& r : results) {
+                SampleSummary stats = r.summary();
+                std::ostringstream interval;
+                interval << std::fixed << std::setprecision(2) << stats.ci_low << " - " << stats.ci_high;
+                out << std::left << std::setw(engine_width) << r.engine << std::setw(4) << ycsb_workload_name(r.workload)
+                    << std::setw(12) << r.chooser << std::right << std::setw(12) << r.records
+                    << std::setw(10) << r.mops() << std::setw(10) << stats.median << std::setw(22) << interval.str();
+                out << std::setprecision(0);
+                for (double percent : percents) out << std::setw(10) << r.latency_percentile(percent);
+                out << std::setw(12) << r.latency_percentile(100) << std::setprecision(2) << "\n";
+            }
+        }
+    }
+
+    // Wczytuje wyniki bazowe z pliku zapisanego przez --format=csv. Zwraca false przy bledzie.
+    static bool load_baseline(const std::string& path, std::vector<BaselineEntry>& entries, std::string& error) {
+        std::ifstream in(path);
+        if (!in) {
+            error = "cannot open baseline " + path;
+            return false;
+        }
+        std::string line;
+        std::getline(in, line);
+        std::vector<std::string> header = split(line, ',');
+        auto column = [&](const char* name) {
+            return static_cast<size_t>(std::find(header.begin(), header.end(), name) - header.begin());
+        };
+        const size_t median = column("median_ns_per_op");
+        const size_t ci_low = column("ci_low_ns");
+        const size_t ci_high = column("ci_high_ns");
+        const size_t load_factor = column("load_factor");     // Brak w plikach sprzed przegladu wspolczynnikow
+        const size_t growth_factor = column("growth_factor");
+        if (header.size() < 5 || median == header.size() || ci_low == header.size() || ci_high == header.size()) {
+            error = "baseline " + path + " has no median/CI columns (write it with --format=csv)";
+            return false;
+        }
+        while (std::getline(in, line)) {
+            std::vector<std::string> fields = split(line, ',');
+            if (fields.size() != header.size()) continue;
+            BaselineEntry entry;
+            double lf = 0;
+            double growth = 0;
+            if (!parse_double(fields[median], entry.summary.median) ||
+                !parse_double(fields[ci_low], entry.summary.ci_low) ||
+                !parse_double(fields[ci_high], entry.summary.ci_high) ||
+                (load_factor < header.size() && !parse_double(fields[load_factor], lf)) ||
+                (growth_factor < header.size() && !parse_double(fields[growth_factor], growth))) {
+                error = "invalid baseline line: " + line;
+                return false;
+            }
+            entry.cell = BenchmarkResult::cell_id(fields[0] + "," + fields[1] + "," + fields[2] + "," + fields[3] + "," +
+                                                  fields[4], lf, growth);
+            entries.push_back(entry);
+        }
+        return true;
+    }
+
+    // Porownuje wyniki z bazowymi; wypisuje raport i zwraca liczbe istotnych spowolnien.
+    static size_t compare_with_baseline(const std::vector<BenchmarkResult>& results,
+                                        const std::vector<BaselineEntry>& baseline,
+                                        double threshold, std::ostream& out) {
+        size_t regressions = 0;
+        out << "Comparison with baseline (regression: median slower by more than "
+            << threshold * 100 << "% and disjoint 95% CIs):\n";
+        out << std::fixed << std::setprecision(2);
+        for (const auto& r : results) {
+            std::string cell = r.cell();
+            auto it = std::find_if(baseline.begin(), baseline.end(),
+                                   [&](const BaselineEntry& entry) { return entry.cell == cell; });
+            out << "  " << std::left << std::setw(48) << cell << std::right;
+            if (it == baseline.end()) {
+                out << "  no baseline\n";
+                continue;
+            }
+            SampleSummary current = r.summary();
+            double change = it->summary.median > 0 ? (current.median / it->summary.median - 1) * 100 : 0.0;
+            out << std::setw(10) << it->summary.median << " -> " << std::setw(10) << current.median << " ns  "
+                << std::showpos << std::setw(8) << change << "%" << std::noshowpos;
+            if (is_significant_slowdown(it->summary, current, threshold)) {
+                out << "  REGRESSION";
+                ++regressions;
+            }
+            else if (is_significant_slowdown(current, it->summary, threshold)) {
+                out << "  faster";
+            }
+            out << "\n";
+        }
+        out << regressions << " significant regression(s)\n";
+        return regressions;
+    }
+
+    // Zapisuje wyniki w wybranym formacie.
+    static void write_results(std::ostream& out, const std::string& format,
+                              const std::vector<BenchmarkResult>& results) {
+        if (format == "csv") {
+            out << "engine,operation,distribution,size,threads,reps,mean_ns_per_op,min_ns_per_op,mops,"
+                << "median_ns_per_op,mad_ns,ci_low_ns,ci_high_ns,outliers,regime,load_factor,growth_factor,bytes_per_entry\n";
+            for (const auto& r : results) {
+                SampleSummary stats = r.summary();
+                out << r.engine << "," << r.operation << "," << key_distribution_name(r.distribution) << ","
+                    << r.size << "," << r.threads << "," << r.ns_per_op.size() << ","
+                    << r.mean_ns() << "," << r.min_ns() << "," << r.mean_mops() << ","
+                    << stats.median << "," << stats.mad << "," << stats.ci_low << "," << stats.ci_high << ","
+                    << stats.outliers << "," << r.regime << "," << r.load_factor << "," << r.growth_factor << ","
+                    << r.bytes_per_entry << "\n";
+            }
+        }
+        else if (format == "json") {
+            out << "{\n  \"simd_kernels\": \"" << cpu_kernels_description() << "\",\n"
+                << "  \"timer\": \"" << precision_timer().description() << "\",\n"
+                << "  \"memory\": \"" << memory_description() << "\",\n  \"results\": [\n";
+            for (size_t i = 0; i < results.size(); ++i) {
+                const auto& r = results[i];
+                out << "    {\"engine\": \"" << r.engine << "\", \"operation\": \"" << r.operation
+                    << "\", \"distribution\": \"" << key_distribution_name(r.distribution)
+                    << "\", \"size\": " << r.size << ", \"regime\": \"" << r.regime << "\", \"threads\": " << r.threads
+                    << ", \"load_factor\": " << r.load_factor << ", \"growth_factor\": " << r.growth_factor
+                    << ", \"bytes_per_entry\": " << r.bytes_per_entry << ", \"ns_per_op\": [";
+                for (size_t j = 0; j < r.ns_per_op.size(); ++j) {
+                    out << (j ? ", " : "") << r.ns_per_op[j];
+                }
+                SampleSummary stats = r.summary();
+                out << "], \"mean_ns_per_op\": " << r.mean_ns() << ", \"median_ns_per_op\": " << stats.median
+                    << ", \"mad_ns\": " << stats.mad << ", \"ci95_ns\": [" << stats.ci_low << ", " << stats.ci_high
+                    << "], \"outliers\": " << stats.outliers << ", \"mops\": " << r.mean_mops() << "}"
+                    << (i + 1 < results.size() ? "," : "") << "\n";
+            }
+            out << "  ]\n}\n";
+        }
+        else {
+            out << "SIMD kernels: " << cpu_kernels_description() << "\n";
+            out << "Timer: " << precision_timer().description() << "\n";
+            out << "Memory: " << memory_description() << "\n";
+            const int engine_width = engine_column_width(results, 16);
+            out << std::left << std::setw(engine_width) << "engine" << std::setw(8) << "op" << std::setw(12) << "dist"
+                << std::right << std::setw(12) << "size" << std::setw(7) << "mem" << std::setw(8) << "threads"
+                << std::setw(12) << "ns/op" << std::setw(12) << "min ns/op" << std::setw(12) << "median"
+                << std::setw(22) << "95% CI" << std::setw(12) << "Mops/s" << std::setw(6) << "lf"
+                << std::setw(10) << "B/entry" << "\n";
+            out << std::fixed << std::setprecision(2);
+            for (const auto& r : results) {
+                out << std::left << std::setw(engine_width) << r.engine << std::setw(8) << r.operation
+                    << std::setw(12) << key_distribution_name(r.distribution)
+                    << std::right << std::setw(12) << r.size << std::setw(7) << r.regime << std::setw(8) << r.threads
+                    << std::setw(12) << r.mean_ns() << std::setw(12) << r.min_ns();
+                SampleSummary stats = r.summary();
+                std::ostringstream interval;
+                interval << std::fixed << std::setprecision(2) << stats.ci_low << " - " << stats.ci_high;
+                out << std::setw(12) << stats.median << std::setw(22) << interval.str()
+                    << std::setw(12) << r.mean_mops() << std::setw(6)
+                    << (r.load_factor > 0 ? BenchmarkResult::format_factor(r.load_factor) : "-")
+                    << std::setw(10) << r.bytes_per_entry << "\n";
+            }
+            if (std::any_of(results.begin(), results.end(), [](const BenchmarkResult& r) { return r.load_factor > 0; })) {
+                write_load_factor_plot(out, results);
+            }
+        }
+    }
+
+    // Wykres tekstowy przegladu wspolczynnikow: dla kazdej serii (silnik, operacja, rozklad, rozmiar,
+    // watki) wiersz na wspolczynnik - pamiec na element i slupek przepustowosci (skala serii).
+    static void write_load_factor_plot(std::ostream& out, const std::vector<BenchmarkResult>& results) {
+        static constexpr int BAR_WIDTH = 40;
+        out << "\nThroughput vs memory (load factor sweep):\n";
+        std::vector<bool> plotted(results.size(), false);
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (plotted[i] || results[i].load_factor <= 0) continue;
+            const BenchmarkResult& head = results[i];
+            std::vector<const BenchmarkResult*> series;
+            for (size_t j = i; j < results.size(); ++j) {
+                const BenchmarkResult& r = results[j];
+                if (!plotted[j] && r.load_factor > 0 && r.engine == head.engine && r.operation == head.operation &&
+                    r.distribution == head.distribution && r.size == head.size && r.threads == head.threads) {
+                    series.push_back(&r);
+                    plotted[j] = true;
+                }
+            }
+            double best = 0;
+            for (const auto* r : series) best = std::max(best, r->mean_mops());
+            out << head.engine << " " << head.operation << ", " << key_distribution_name(head.distribution) << ", size "
+                << head.size << ", " << head.threads << " thread(s):\n";
+            for (const auto* r : series) {
+                int bar = best > 0 ? static_cast<int>(r->mean_mops() / best * BAR_WIDTH + 0.5) : 0;
+                out << "  lf " << std::left << std::setw(6) << BenchmarkResult::format_factor(r->load_factor)
+                    << std::right << std::setw(8) << r->bytes_per_entry << " B/entry  " << std::left
+                    << std::setw(BAR_WIDTH) << std::string(static_cast<size_t>(bar), '#') << std::right << " "
+                    << r->mean_mops() << " Mops/s\n";
+            }
+        }
+    }
+};
+
+// Punkt wejscia dla wywolania z argumentami. Zwraca kod wyjscia programu.
+inline int run_benchmark_cli(int argc, char** argv) {
+    BenchmarkOptions options;
+    std::string error;
+    if (!BenchmarkDriver::parse_args(argc, argv, options, error)) {
+        if (!error.empty()) {
+            std::cerr << "Error: " << error << "\n";
+        }
+        BenchmarkDriver::print_usage(error.empty() ? std::cout : std::cerr);
+        return error.empty() ? 0 : 2;
+    }
+
+    if (!options.replay.empty() &&
+        (!options.baseline.empty() || !options.workloads.empty() || options.soak_operations)) {
+        std::cerr << "Error: --replay cannot be combined with --baseline, --ycsb or --soak\n";
+        return 2;
+    }
+    if (options.soak_operations && (!options.baseline.empty() || !options.workloads.empty())) {
+        std::cerr << "Error: --soak cannot be combined with --baseline or --ycsb\n";
+        return 2;
+    }
+    if (!options.workloads.empty() && !options.baseline.empty()) {
+        std::cerr << "Error: --baseline is not supported with --ycsb\n";
+        return 2;
+    }
+
+    // Plik bazowy jest wczytywany przed pomiarami, aby blad w nazwie nie zmarnowal przebiegu
+    std::vector<BaselineEntry> baseline;
+    if (!options.baseline.empty() && !BenchmarkDriver::load_baseline(options.baseline, baseline, error)) {
+        std::cerr << "Error: " << error << "\n";
+        return 2;
+    }
+
+    // Z tego samego powodu plik wynikowy jest otwierany (i sprawdzany) przed pomiarami
+    std::ofstream file;
+    if (options.output != "-") {
+        file.open(options.output);
+        if (!file) {
+            std::cerr << "Error: cannot open " << options.output << "\n";
+            return 1;
+        }
+    }
+    std::ostream& out = options.output == "-" ? std::cout : file;
+
+    BenchmarkDriver driver;
+    if (!options.replay.empty()) {
+        std::vector<TraceReplayResult> results;
+        if (!driver.run_replay(options, results, error)) {
+            std::cerr << "Error: " << error << "\n";
+            return 1;
+        }
+        BenchmarkDriver::write_replay_results(out, options.format, options.replay, results);
+        return 0;
+    }
+    if (options.soak_operations) {
+        BenchmarkDriver::write_soak_results(out, options.format, driver.run_soak(options));
+        return 0;
+    }
+    if (!options.workloads.empty()) {
+        BenchmarkDriver::write_ycsb_results(out, options.format, driver.run_ycsb(options));
+        return 0;
+    }
+
+    std::vector<BenchmarkResult> results = driver.run(options);
+    BenchmarkDriver::write_results(out, options.format, results);
+
+    // Raport porownania trafia na std::cerr, aby nie mieszal sie z wynikami CSV/JSON na stdout
+    if (!options.baseline.empty() &&
+        BenchmarkDriver::compare_with_baseline(results, baseline, options.regression_threshold, std::cerr) > 0) {
+        return 3;
+    }
+    return 0;
+}
+
+#endif // BENCHMARK_DRIVER_H
@@ -0,0 +1,113 @@
+#ifndef BENCHMARK_STATS_H
+#define BENCHMARK_STATS_H
+
+#include "key_generator.h" // SplitMix64 - powtarzalne losowanie prob bootstrap
+#include <algorithm> // std::nth_element, std::sort
+#include <cmath>     // std::fabs, std::floor
+#include <cstdint>   // uint64_t
+#include <vector>
+
+// Statystyki pomiarow jednej komorki benchmarku (silnik x operacja x rozmiar ...).
+// Czasy operacji maja rozklad z dlugim prawym ogonem (przerwania, przelaczenia watkow,
+// migracje stron), wiec srednia i odchylenie standardowe sa malo wiarygodne.
+// Uzywamy mediany, MAD (mediana odchylen bezwzglednych od mediany) i przedzialu
+// ufnosci mediany liczonego metoda bootstrap (percentylowa).
+
+// Podsumowanie probek.
+struct SampleSummary {
+    size_t count = 0;     // Liczba probek po odrzuceniu wartosci odstajacych
+    size_t outliers = 0;  // Liczba odrzuconych probek
+    double mean = 0;      // Srednia (po odrzuceniu wartosci odstajacych)
+    double median = 0;
+    double mad = 0;       // MAD przeskalowane (x1.4826) - przy rozkladzie normalnym rowne odchyleniu standardowemu
+    double ci_low = 0;    // Dolna granica przedzialu ufnosci mediany
+    double ci_high = 0;   // Gorna granica przedzialu ufnosci mediany
+};
+
+// Mediana (kopia - wejscie nie jest zmieniane).
+inline double median_of(std::vector<double> values) {
+    if (values.empty()) return 0.0;
+    size_t middle = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + middle, values.end());
+    double upper = values[middle];
+    if (values.size() % 2) return upper;
+    double lower = *std::max_element(values.begin(), values.begin() + middle);
+    return (lower + upper) / 2;
+}
+
+// Przeskalowane MAD wzgledem podanej mediany.
+inline double mad_of(const std::vector<double>& values, double median) {
+    std::vector<double> deviations(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        deviations[i] = std::fabs(values[i] - median);
+    }
+    return 1.4826 * median_of(deviations);
+}
+
+// Liczy podsumowanie probek:
+//  - odrzuca wartosci odstajace: |x - mediana| > OUTLIER_LIMIT * MAD (zmodyfikowany z-score;
+//    tylko gdy probek jest co najmniej MIN_SAMPLES - przy 3 probkach "odstajaca" jest co trzecia),
+//  - dla pozostalych liczy srednia, mediane i MAD,
+//  - przedzial ufnosci 'confidence' dla mediany: 'resamples' losowan ze zwracaniem,
+//    granice to percentyle rozkladu median z tych losowan. Przy mniej niz MIN_SAMPLES probkach
+//    bootstrap daje zbyt waskie przedzialy (mediana losowania to prawie zawsze jedna z 2-3
+//    wartosci), wiec przedzialem jest wtedy caly zakres probek.
+// Ziarno jest stale, aby ten sam zestaw probek dawal zawsze ten sam przedzial.
+inline SampleSummary summarize_samples(const std::vector<double>& samples, double confidence = 0.95,
+                                       int resamples = 2000) {
+    static constexpr double OUTLIER_LIMIT = 3.5;
+    static constexpr size_t MIN_SAMPLES = 5;
+    SampleSummary summary;
+    if (samples.empty()) return summary;
+
+    double raw_median = median_of(samples);
+    double raw_mad = mad_of(samples, raw_median);
+    std::vector<double> kept;
+    kept.reserve(samples.size());
+    for (double x : samples) {
+        if (samples.size() < MIN_SAMPLES || raw_mad == 0 || std::fabs(x - raw_median) <= OUTLIER_LIMIT * raw_mad) {
+            kept.push_back(x);
+        }
+    }
+    summary.count = kept.size();
+    summary.outliers = samples.size() - kept.size();
+
+    double sum = 0;
+    for (double x : kept) sum += x;
+    summary.mean = sum / kept.size();
+    summary.median = median_of(kept);
+    summary.mad = mad_of(kept, summary.median);
+
+    if (kept.size() < MIN_SAMPLES) {
+        summary.ci_low = *std::min_element(kept.begin(), kept.end());
+        summary.ci_high = *std::max_element(kept.begin(), kept.end());
+        return summary;
+    }
+    SplitMix64 rng(0x5eed);
+    std::vector<double> medians(static_cast<size_t>(resamples));
+    std::vector<double> resample(kept.size());
+    for (int r = 0; r < resamples; ++r) {
+        for (size_t i = 0; i < kept.size(); ++i) {
+            resample[i] = kept[rng.below(kept.size())];
+        }
+        medians[static_cast<size_t>(r)] = median_of(resample);
+    }
+    std::sort(medians.begin(), medians.end());
+    double tail = (1.0 - confidence) / 2;
+    size_t low = static_cast<size_t>(std::floor(tail * (resamples - 1)));
+    size_t high = static_cast<size_t>(std::floor((1.0 - tail) * (resamples - 1) + 0.5));
+    summary.ci_low = medians[low];
+    summary.ci_high = medians[high];
+    return summary;
+}
+
+// Czy 'current' jest istotnie wolniejszy od 'baseline' (czasy - wiecej znaczy wolniej):
+// mediana wzrosla o wiecej niz 'min_slowdown' (np. 0.05 = 5%) i przedzialy ufnosci sie nie
+// nakladaja. Sam brak nakladania sie przedzialow przy bardzo waskich przedzialach zglaszalby
+// nieistotne praktycznie roznice, sam prog - przypadkowy szum.
+inline bool is_significant_slowdown(const SampleSummary& baseline, const SampleSummary& current,
+                                    double min_slowdown) {
+    return current.median > baseline.median * (1.0 + min_slowdown) && current.ci_low > baseline.ci_high;
+}
+
+#endif // BENCHMARK_STATS_H
@@ -0,0 +1,231 @@
+#ifndef BLOOM_FILTERED_HASH_TABLE_H
+#define BLOOM_FILTERED_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "engine_registry.h" // Rejestracja jako dekorator ("bloom-<silnik>")
+#include <algorithm> // std::fill dla generacji blokow
+#include <cstdint> // uint64_t dla slow filtra
+#include <memory>  // std::unique_ptr dla opakowywanej tabeli
+
+// Blokowy filtr Blooma postawiony przed dowolna implementacja tabeli (dekorator).
+// Wiekszosc zapytan o nieobecne klucze jest odrzucana po odczycie jednego 64-bajtowego
+// bloku (jednej linii cache), bez przechodzenia po drzewie AVL czy lancuchu kubka.
+//
+// Kazdy klucz ustawia BITS_PER_KEY_SET bitow w jednym bloku 512-bitowym wybranym hashem.
+// Filtr jest aktualizowany przy insert. Bitow nie da sie usunac, dlatego po remove
+// filtr przepuszcza coraz wiecej nieobecnych kluczy - rebuild_filter() odbudowuje go
+// z zawartosci tabeli (wywolywane tez automatycznie, gdy usunieto zbyt wiele kluczy
+// lub tabela urosla ponad rozmiar filtra).
+//
+// clear() jest O(1) jak w opakowanych tabelach: kazdy blok ma numer generacji
+// (w osobnej, 16x mniejszej tablicy), a blok z innej generacji jest traktowany jako pusty.
+class BloomFilteredHashTable : public HashTableBase {
+private:
+    // Blok filtra wyrownany do linii cache.
+    struct alignas(64) Block {
+        uint64_t words[8] = {};
+    };
+
+    static constexpr size_t FILTER_BITS_PER_KEY = 10;  // Bity filtra na klucz (ok. 1% falszywych trafien)
+    static constexpr unsigned int BITS_PER_KEY_SET = 6; // Bity ustawiane w bloku dla kazdego klucza
+    static constexpr size_t MIN_BLOCKS = 1;
+
+    std::unique_ptr<HashTableBase> inner; // Wlasciwa tabela
+    std::vector<Block> blocks;            // Bity filtra
+    std::vector<uint32_t> block_generations; // Generacja kazdego bloku (bity wazne tylko w biezacej)
+    uint32_t generation;     // Biezaca generacja filtra (zwiekszana przez clear)
+    size_t planned_keys;     // Liczba kluczy, dla ktorej zwymiarowano filtr
+    size_t removed_since_rebuild; // Usuniecia od ostatniej odbudowy (bity, ktore zostaly "na zawsze")
+
+    // 64-bitowy hash klucza (finalizator MurmurHash3): mlodsza czesc wybiera blok, starsza - bity w bloku.
+    static uint64_t key_hash(int key) {
+        uint64_t h = static_cast<uint32_t>(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Liczba blokow dla danej liczby kluczy - potega dwojki, aby blok wybierac maska zamiast modulo.
+    static size_t blocks_for(size_t keys) {
+        size_t bits = keys * FILTER_BITS_PER_KEY;
+        size_t count = MIN_BLOCKS;
+        while (count * 512 < bits) {
+            count *= 2;
+        }
+        return count;
+    }
+
+    // Pozycje bitow w bloku wyznaczane podwojnym hashowaniem: bit_i = (a + i * b) mod 512.
+    static unsigned int bit_start(uint64_t h) { return static_cast<unsigned int>(h >> 32) & 511; }
+    static unsigned int bit_step(uint64_t h) { return (static_cast<unsigned int>(h >> 41) & 511) | 1; }
+
+    void add_to_filter(int key) {
+        uint64_t h = key_hash(key);
+        size_t index = static_cast<size_t>(h) & (blocks.size() - 1);
+        Block& block = blocks[index];
+        if (block_generations[index] != generation) {
+            block = Block(); // Blok z poprzedniej generacji - wyzeruj przy pierwszym uzyciu
+            block_generations[index] = generation;
+        }
+        unsigned int bit = bit_start(h);
+        unsigned int step = bit_step(h);
+        for (unsigned int i = 0; i < BITS_PER_KEY_SET; ++i, bit = (bit + step) & 511) {
+            block.words[bit >> 6] |= uint64_t{ 1 } << (bit & 63);
+        }
+    }
+
+    // false oznacza, ze klucza na pewno nie ma w tabeli.
+    bool may_contain(int key) const {
+        uint64_t h = key_hash(key);
+        size_t index = static_cast<size_t>(h) & (blocks.size() - 1);
+        if (block_generations[index] != generation) {
+            return false; // Blok pusty od ostatniego clear()
+        }
+        const Block& block = blocks[index];
+        unsigned int bit = bit_start(h);
+        unsigned int step = bit_step(h);
+        for (unsigned int i = 0; i < BITS_PER_KEY_SET; ++i, bit = (bit + step) & 511) {
+            if (!(block.words[bit >> 6] & (uint64_t{ 1 } << (bit & 63)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    // 'expected_keys' - poczatkowy rozmiar filtra; filtr rosnie razem z tabela.
+    explicit BloomFilteredHashTable(std::unique_ptr<HashTableBase> inner_table, size_t expected_keys = 1024)
+        : inner(std::move(inner_table)), generation(1), planned_keys(expected_keys), removed_since_rebuild(0) {
+        rebuild_filter();
+    }
+
+    // Odbudowuje filtr z aktualnej zawartosci tabeli (usuwa bity kluczy usunietych).
+    void rebuild_filter() {
+        if (planned_keys < inner->size()) {
+            planned_keys = inner->size() * 2; // Zapas, aby nie odbudowywac przy kazdym wzroscie
+        }
+        blocks.assign(blocks_for(planned_keys), Block());
+        block_generations.assign(blocks.size(), generation);
+        inner->for_each([this](int key, int) { add_to_filter(key); });
+        removed_since_rebuild = 0;
+    }
+
+    bool insert(int key, int value) override {
+        if (!inner->insert(key, value)) {
+            return false;
+        }
+        if (inner->size() > planned_keys) {
+            rebuild_filter(); // Filtr za maly - falszywe trafienia rosna; powieksz go
+        }
+        else {
+            add_to_filter(key);
+        }
+        return true;
+    }
+
+    bool remove(int key) override {
+        if (!may_contain(key)) {
+            return false;
+        }
+        if (!inner->remove(key)) {
+            return false;
+        }
+        // Gdy bity usunietych kluczy stanowia wiekszosc filtra, odbuduj go
+        if (++removed_since_rebuild > inner->size() && removed_since_rebuild > 64) {
+            rebuild_filter();
+        }
+        return true;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Nieobecne klucze sa zwykle odrzucane przez filtr; waznosc wskaznika jak w opakowanej tabeli.
+    int* find_ptr(int key) override {
+        if (!may_contain(key)) {
+            return nullptr;
+        }
+        return inner->find_ptr(key);
+    }
+
+    const int* find_ptr(int key) const override {
+        if (!may_contain(key)) {
+            return nullptr;
+        }
+        return static_cast<const HashTableBase&>(*inner).find_ptr(key);
+    }
+
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        inner->for_each(visit);
+    }
+
+    void display() override {
+        inner->display();
+        std::cout << "Bloom filter: " << blocks.size() << " blocks (" << bits_per_key()
+                  << " bits/key), removed since rebuild: " << removed_since_rebuild << std::endl;
+    }
+
+    size_t size() const override { return inner->size(); }
+
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(blocks.capacity() * sizeof(Block))
+            + heap_block_bytes(block_generations.capacity() * sizeof(uint32_t)) + inner->memory_usage();
+    }
+
+    // Statystyki opakowanej tabeli - chybienia odrzucone przez filtr nie dochodza do niej wcale.
+    bool probe_stats(ProbeStats& stats) const override { return inner->probe_stats(stats); }
+
+    // Wspolczynnik wypelnienia i wzrost dotycza opakowanej tabeli (filtr rosnie razem z nia).
+    bool set_max_load_factor(double value) override { return inner->set_max_load_factor(value); }
+
+    bool set_growth_factor(double value) override { return inner->set_growth_factor(value); }
+
+    double get_max_load_factor() const override { return inner->get_max_load_factor(); }
+
+    double get_growth_factor() const override { return inner->get_growth_factor(); }
+
+    void clear() override {
+        clear(false);
+    }
+
+    void clear(bool release_storage) override {
+        inner->clear(release_storage);
+        if (release_storage) {
+            std::vector<Block>(MIN_BLOCKS).swap(blocks); // Oddaj pamiec filtra
+            std::vector<uint32_t>(MIN_BLOCKS, generation).swap(block_generations);
+            planned_keys = MIN_BLOCKS * 512 / FILTER_BITS_PER_KEY;
+        }
+        else if (++generation == 0) {
+            // Przepelnienie licznika (raz na 2^32 wywolan) - jednorazowe zerowanie generacji blokow
+            std::fill(block_generations.begin(), block_generations.end(), 0);
+            generation = 1;
+        }
+        removed_since_rebuild = 0;
+    }
+
+    // Rozmiar filtra w bitach na element tabeli.
+    double bits_per_key() const {
+        return inner->size() ? blocks.size() * 512.0 / inner->size() : 0.0;
+    }
+
+    std::string get_name() const override {
+        return "Bloom + " + inner->get_name();
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h): "bloom-avl" itd. to filtr przed dowolnym silnikiem.
+inline const bool bloom_filtered_hash_table_registered = register_engine_decorator({
+    "bloom", 1.25, // 10 bitow filtra na klucz
+    [](std::unique_ptr<HashTableBase> inner, size_t n) {
+        return std::unique_ptr<HashTableBase>(new BloomFilteredHashTable(std::move(inner), n)); } });
+
+#endif // BLOOM_FILTERED_HASH_TABLE_H
@@ -0,0 +1,549 @@
+#ifndef BTREE_HASH_TABLE_H
+#define BTREE_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "node_arena.h"      // Pula wezlow z szybkim zwalnianiem wszystkich naraz
+#include "cpu_dispatch.h"    // count_less_int - pozycja klucza w wezle (SIMD)
+#include "engine_registry.h" // Rejestracja w benchmarkach i demonstracji
+#include <algorithm> // std::max
+#include <cmath>     // std::ceil - nowy rozmiar przy wzroscie
+#include <cstddef>   // offsetof
+#include <cstdint>   // uint16_t, uint32_t
+#include <utility>   // std::pair
+
+// Hash Table z kubelkami zawierajacymi B-drzewa (wariant z CLRS: wartosci takze w wezlach
+// wewnetrznych, minimalny stopien t = 8, wiec wezel ma 7 - 15 kluczy).
+//
+// Tak jak AVLHashTable, tabela ma gwarancje O(log n) na operacje nawet wtedy, gdy klucze
+// dobrane zlosliwie trafiaja do jednego kubelka. Drzewo AVL przy takim kubelku ma wysokosc
+// ok. 1.44 log2(n) i kazdy poziom to osobny wezel - osobne chybienie w cache. Tu wezel
+// zaczyna sie linia cache (64 bajty) z 15 posortowanymi kluczami, przeszukiwanymi naraz
+// porownaniem SIMD (count_less_int), a wysokosc drzewa to ok. log8(n) - dla miliona kluczy
+// w jednym kubelku 7 linii zamiast ok. 28 wezlow AVL.
+//
+// Przy typowych (losowych) kluczach wiekszosc kubelkow to jeden lisc, dlatego domyslny
+// maksymalny wspolczynnik wypelnienia jest wyzszy (8): kubelek miesci sie w jednym wezle,
+// a wyszukiwanie czyta wektor kubelkow, linie kluczy i sasiednia linie wartosci.
+class BTreeHashTable : public HashTableBase {
+private:
+    static constexpr int MIN_DEGREE = 8;                 // t - minimalny stopien (CLRS)
+    static constexpr int MAX_KEYS = 2 * MIN_DEGREE - 1;  // 15 kluczy + licznik = 64 bajty
+    static constexpr int MIN_KEYS = MIN_DEGREE - 1;      // Najmniej kluczy w wezle innym niz korzen
+
+    // Wezel: pierwsza linia cache to klucze, licznik i rodzaj wezla, druga - wartosci.
+    // Lisc konczy sie na wartosciach; wezel wewnetrzny (InnerNode) ma jeszcze tablice dzieci.
+    struct alignas(64) Node {
+        int keys[MAX_KEYS]; // Posortowane rosnaco; waznych jest 'count' pierwszych
+        uint16_t count;     // Liczba kluczy
+        uint16_t leaf;      // 1 - lisc (bez dzieci)
+        int values[MAX_KEYS];
+
+        explicit Node(bool is_leaf) : count(0), leaf(is_leaf) {}
+    };
+    static_assert(offsetof(Node, values) == 64, "B-tree node keys must fill exactly one cache line");
+
+    struct InnerNode : Node {
+        Node* children[MAX_KEYS + 1]; // children[i] - klucze miedzy keys[i - 1] a keys[i]
+
+        InnerNode() : Node(false) {}
+    };
+
+    // Kubelek: korzen B-drzewa i generacja tabeli, w ktorej zostal zapisany (jak w AVLHashTable).
+    struct Bucket {
+        Node* root = nullptr;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Bucket> table;   // Wektor korzeni drzew
+    size_t table_size;           // Liczba kubelkow
+    size_t current_size;         // Liczba elementow we wszystkich drzewach
+    uint32_t generation;         // Biezaca generacja tabeli (zwiekszana przez clear)
+    NodeArena<Node> leaves;      // Liscie (128 bajtow)
+    NodeArena<InnerNode> inners; // Wezly wewnetrzne (256 bajtow)
+    double max_load_factor;
+    double growth_factor;
+
+    static constexpr double DEFAULT_MAX_LOAD_FACTOR = 8.0; // Ok. pol wezla na kubelek
+    static constexpr double LOAD_FACTOR_LIMIT = 64.0;
+    static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
+    static constexpr double GROWTH_FACTOR_LIMIT = 4.0;
+
+    bool over_load_factor() const {
+        return static_cast<double>(current_size) / table_size > max_load_factor;
+    }
+
+    Node*& root_at(size_t index) {
+        Bucket& bucket = table[index];
+        if (bucket.generation != generation) {
+            bucket.root = nullptr;
+            bucket.generation = generation;
+        }
+        return bucket.root;
+    }
+
+    // Korzen kubelka bez modyfikacji tabeli: kubelek z poprzedniej generacji jest pusty.
+    Node* live_root(size_t index) const {
+        const Bucket& bucket = table[index];
+        return bucket.generation == generation ? bucket.root : nullptr;
+    }
+
+    static Node** children(Node* node) { return static_cast<InnerNode*>(node)->children; }
+    static Node* const* children(const Node* node) { return static_cast<const InnerNode*>(node)->children; }
+
+    // Indeks pierwszego klucza >= 'key' w wezle.
+    static size_t position(const Node* node, int key) {
+        return count_less_int(node->keys, node->count, key);
+    }
+
+    Node* create_node(bool leaf) {
+        return leaf ? leaves.create(true) : static_cast<Node*>(inners.create());
+    }
+
+    void destroy_node(Node* node) {
+        if (node->leaf) leaves.destroy(node);
+        else inners.destroy(static_cast<InnerNode*>(node));
+    }
+
+    // Wstawia klucz, wartosc i (w wezle wewnetrznym) prawe dziecko na pozycji 'i'.
+    static void insert_at(Node* node, size_t i, int key, int value, Node* right_child) {
+        for (size_t j = node->count; j > i; --j) {
+            node->keys[j] = node->keys[j - 1];
+            node->values[j] = node->values[j - 1];
+        }
+        node->keys[i] = key;
+        node->values[i] = value;
+        if (!node->leaf) {
+            Node** child = children(node);
+            for (size_t j = node->count + 1u; j > i + 1; --j) child[j] = child[j - 1];
+            child[i + 1] = right_child;
+        }
+        node->count++;
+    }
+
+    // Usuwa klucz 'i' i (w wezle wewnetrznym) dziecko na prawo od niego.
+    static void erase_at(Node* node, size_t i) {
+        for (size_t j = i + 1; j < node->count; ++j) {
+            node->keys[j - 1] = node->keys[j];
+            node->values[j - 1] = node->values[j];
+        }
+        if (!node->leaf) {
+            Node** child = children(node);
+            for (size_t j = i + 2; j <= node->count; ++j) child[j - 1] = child[j];
+        }
+        node->count--;
+    }
+
+    // Dzieli pelne dziecko parent->children[i]: mediana przechodzi do rodzica,
+    // gorne MIN_KEYS kluczy (i dzieci) do nowego wezla na prawo (CLRS B-TREE-SPLIT-CHILD).
+    void split_child(Node* parent, size_t i) {
+        Node* full = children(parent)[i];
+        Node* right = create_node(full->leaf);
+        for (int j = 0; j < MIN_KEYS; ++j) {
+            right->keys[j] = full->keys[j + MIN_DEGREE];
+            right->values[j] = full->values[j + MIN_DEGREE];
+        }
+        if (!full->leaf) {
+            for (int j = 0; j < MIN_DEGREE; ++j) children(right)[j] = children(full)[j + MIN_DEGREE];
+        }
+        right->count = MIN_KEYS;
+        full->count = MIN_KEYS;
+        insert_at(parent, i, full->keys[MIN_KEYS], full->values[MIN_KEYS], right);
+    }
+
+    // Wstawia do drzewa kubelka. Pelne wezly sa dzielone w drodze w dol, wiec wstawienie do
+    // liscia nigdy nie wymaga powrotu w gore. Zwraca false, gdy klucz byl (wartosc zaktualizowana).
+    bool insert_tree(Node*& root, int key, int value) {
+        if (!root) {
+            root = create_node(true);
+            insert_at(root, 0, key, value, nullptr);
+            return true;
+        }
+        if (root->count == MAX_KEYS) {
+            Node* top = create_node(false);
+            children(top)[0] = root;
+            split_child(top, 0);
+            root = top; // Drzewo rosnie tylko od korzenia - wszystkie liscie maja te sama glebokosc
+        }
+        Node* node = root;
+        while (true) {
+            size_t i = position(node, key);
+            if (i < node->count && node->keys[i] == key) {
+                node->values[i] = value;
+                return false;
+            }
+            if (node->leaf) {
+                insert_at(node, i, key, value, nullptr);
+                return true;
+            }
+            if (children(node)[i]->count == MAX_KEYS) {
+                split_child(node, i);
+                if (node->keys[i] == key) {
+                    node->values[i] = value;
+                    return false;
+                }
+                if (node->keys[i] < key) ++i;
+            }
+            node = children(node)[i];
+        }
+    }
+
+    // Laczy dzieci i oraz i + 1 z kluczem rozdzielajacym w jedno (lewe) dziecko.
+    void merge_children(Node* node, size_t i) {
+        Node* left = children(node)[i];
+        Node* right = children(node)[i + 1];
+        size_t base = left->count;
+        left->keys[base] = node->keys[i];
+        left->values[base] = node->values[i];
+        for (size_t j = 0; j < right->count; ++j) {
+            left->keys[base + 1 + j] = right->keys[j];
+            left->values[base + 1 + j] = right->values[j];
+        }
+        if (!left->leaf) {
+            for (size_t j = 0; j <= right->count; ++j) children(left)[base + 1 + j] = children(right)[j];
+        }
+        left->count = static_cast<uint16_t>(base + 1 + right->count);
+        erase_at(node, i);
+        destroy_node(right);
+    }
+
+    // Zapewnia, ze dziecko 'i' ma co najmniej MIN_DEGREE kluczy przed zejsciem do niego:
+    // pozycza klucz od sasiada przez rodzica albo laczy dziecko z sasiadem.
+    // Zwraca indeks dziecka, do ktorego trzeba zejsc.
+    size_t fill_child(Node* node, size_t i) {
+        Node* child = children(node)[i];
+        if (i > 0 && children(node)[i - 1]->count > MIN_KEYS) {
+            Node* left = children(node)[i - 1];
+            // Klucz rodzica na poczatek dziecka, ostatnie dziecko lewego sasiada na jego poczatek
+            for (size_t j = child->count; j > 0; --j) {
+                child->keys[j] = child->keys[j - 1];
+                child->values[j] = child->values[j - 1];
+            }
+            child->keys[0] = node->keys[i - 1];
+            child->values[0] = node->values[i - 1];
+            if (!child->leaf) {
+                Node** c = children(child);
+                for (size_t j = child->count + 1u; j > 0; --j) c[j] = c[j - 1];
+                c[0] = children(left)[left->count];
+            }
+            child->count++;
+            // Ostatni klucz lewego sasiada do rodzica
+            node->keys[i - 1] = left->keys[left->count - 1];
+            node->values[i - 1] = left->values[left->count - 1];
+            left->count--;
+            return i;
+        }
+        if (i < node->count && children(node)[i + 1]->count > MIN_KEYS) {
+            Node* right = children(node)[i + 1];
+            child->keys[child->count] = node->keys[i];
+            child->values[child->count] = node->values[i];
+            if (!child->leaf) children(child)[child->count + 1] = children(right)[0];
+            child->count++;
+            node->keys[i] = right->keys[0];
+            node->values[i] = right->values[0];
+            // Usun pierwszy klucz i pierwsze dziecko prawego sasiada
+            for (size_t j = 1; j < right->count; ++j) {
+                right->keys[j - 1] = right->keys[j];
+                right->values[j - 1] = right->values[j];
+            }
+            if (!right->leaf) {
+                for (size_t j = 1; j <= right->count; ++j) children(right)[j - 1] = children(right)[j];
+            }
+            right->count--;
+            return i;
+        }
+        if (i < node->count) {
+            merge_children(node, i);
+            return i;
+        }
+        merge_children(node, i - 1);
+        return i - 1;
+    }
+
+    // Usuwa klucz z drzewa kubelka w jednym przejsciu w dol (CLRS B-TREE-DELETE): kazdy wezel,
+    // do ktorego schodzimy, ma wczesniej co najmniej MIN_DEGREE kluczy, wiec usuniecie z liscia
+    // nie narusza minimum. Klucz z wezla wewnetrznego zastepuje poprzednik lub nastepnik.
+    bool remove_tree(Node*& root, int key) {
+        if (!root) return false;
+        bool removed = false;
+        Node* node = root;
+        while (true) {
+            size_t i = position(node, key);
+            bool here = i < node->count && node->keys[i] == key;
+            if (node->leaf) {
+                if (here) {
+                    erase_at(node, i);
+                    removed = true;
+                }
+                break;
+            }
+            if (here) {
+                Node* left = children(node)[i];
+                Node* right = children(node)[i + 1];
+                if (left->count > MIN_KEYS) {
+                    Node* p = left; // Poprzednik: skrajnie prawy klucz lewego poddrzewa
+                    while (!p->leaf) p = children(p)[p->count];
+                    node->keys[i] = p->keys[p->count - 1];
+                    node->values[i] = p->values[p->count - 1];
+                    key = node->keys[i]; // Dalej usuwany jest poprzednik z lewego poddrzewa
+                    node = left;
+                }
+                else if (right->count > MIN_KEYS) {
+                    Node* s = right; // Nastepnik: skrajnie lewy klucz prawego poddrzewa
+                    while (!s->leaf) s = children(s)[0];
+                    node->keys[i] = s->keys[0];
+                    node->values[i] = s->values[0];
+                    key = node->keys[i];
+                    node = right;
+                }
+                else {
+                    merge_children(node, i); // Klucz schodzi do polaczonego dziecka
+                    node = left;
+                }
+                continue;
+            }
+            if (children(node)[i]->count == MIN_KEYS) {
+                i = fill_child(node, i);
+            }
+            node = children(node)[i];
+        }
+        // Polaczenie dwoch ostatnich dzieci korzenia zostawia pusty korzen - drzewo maleje o poziom
+        if (root->count == 0) {
+            Node* old = root;
+            root = old->leaf ? nullptr : children(old)[0];
+            destroy_node(old);
+        }
+        return removed;
+    }
+
+    // Linia wartosci jest pobierana rownolegle z linia kluczy - przy trafieniu w lisciu
+    // (najczestszy przypadek) drugie chybienie w cache nie czeka na przeszukanie kluczy.
+    static const int* find_in_tree(const Node* node, int key) {
+        while (node) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(node->values);
+#endif
+            size_t i = position(node, key);
+            if (i < node->count && node->keys[i] == key) {
+                return &node->values[i];
+            }
+            if (node->leaf) return nullptr;
+            node = children(node)[i];
+        }
+        return nullptr;
+    }
+
+    static void for_each_tree(const Node* node, const std::function<void(int, int)>& visit) {
+        for (size_t i = 0; i < node->count; ++i) {
+            if (!node->leaf) for_each_tree(children(node)[i], visit);
+            visit(node->keys[i], node->values[i]);
+        }
+        if (!node->leaf) for_each_tree(children(node)[node->count], visit);
+    }
+
+    // Sumuje glebokosci kluczy (wezly odczytane przy trafieniu); 'height' - glebokosc lisci.
+    static void probe_depths_tree(const Node* node, size_t depth, double& hit_total, size_t& height) {
+        hit_total += static_cast<double>(node->count * (depth + 1));
+        if (node->leaf) {
+            height = depth + 1;
+            return;
+        }
+        for (size_t i = 0; i <= node->count; ++i) probe_depths_tree(children(node)[i], depth + 1, hit_total, height);
+    }
+
+    static void display_tree(const Node* node, int depth) {
+        if (!node->leaf) display_tree(children(node)[node->count], depth + 1);
+        for (int i = 0; i < depth; ++i) std::cout << "  ";
+        for (size_t i = node->count; i-- > 0;) {
+            std::cout << "(" << node->keys[i] << "," << node->values[i] << ")";
+        }
+        std::cout << std::endl;
+        if (!node->leaf) {
+            for (size_t i = node->count; i-- > 0;) display_tree(children(node)[i], depth + 1);
+        }
+    }
+
+    void ensure_allocated() {
+        if (table.empty()) {
+            if (table_size == 0) table_size = 1;
+            table.resize(table_size);
+        }
+    }
+
+    // Zwieksza liczbe kubelkow 'growth_factor' razy. Elementy sa kopiowane na bok, areny
+    // czyszczone (bloki zostaja), a drzewa budowane od nowa - nowe wezly zajmuja te same bloki.
+    void resize() {
+        std::vector<std::pair<int, int>> entries;
+        entries.reserve(current_size);
+        for_each([&entries](int key, int value) { entries.emplace_back(key, value); });
+
+        size_t grown = static_cast<size_t>(std::ceil(table_size * growth_factor));
+        table_size = grown > table_size ? grown : table_size + 1;
+        leaves.reset();
+        inners.reset();
+        table.clear();
+        table.resize(table_size);
+        for (const auto& entry : entries) {
+            insert_tree(root_at(hash_function(entry.first, table_size)), entry.first, entry.second);
+        }
+    }
+
+public:
+    // 'initial_size' to liczba kubelkow (jak w AVLHashTable); wektor korzeni jest alokowany leniwie -
+    // przy pierwszym insert.
+    // Wartosci spoza dozwolonego zakresu sa ignorowane (patrz set_max_load_factor / set_growth_factor).
+    explicit BTreeHashTable(size_t initial_size = 16, double max_load_factor = DEFAULT_MAX_LOAD_FACTOR,
+                            double growth_factor = DEFAULT_GROWTH_FACTOR)
+        : table_size(initial_size), current_size(0), generation(1),
+          max_load_factor(DEFAULT_MAX_LOAD_FACTOR), growth_factor(DEFAULT_GROWTH_FACTOR) {
+        set_max_load_factor(max_load_factor);
+        set_growth_factor(growth_factor);
+    }
+
+    bool insert(int key, int value) override {
+        ensure_allocated();
+        if (over_load_factor()) {
+            resize();
+        }
+        if (insert_tree(root_at(hash_function(key, table_size)), key, value)) {
+            current_size++;
+        }
+        return true;
+    }
+
+    bool remove(int key) override {
+        if (table.empty()) return false;
+        if (remove_tree(root_at(hash_function(key, table_size)), key)) {
+            current_size--;
+            return true;
+        }
+        return false;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Zwraca wskaznik do wartosci w wezle lub nullptr.
+    // Wartosci NIE sa stabilne: insert i remove przesuwaja je w wezlach (podzial, laczenie,
+    // pozyczanie), wiec wskaznik traci waznosc przy kazdym insert, remove oraz clear.
+    const int* find_ptr(int key) const override {
+        if (table.empty()) return nullptr;
+        return find_in_tree(live_root(hash_function(key, table_size)), key);
+    }
+
+    int* find_ptr(int key) override {
+        return const_cast<int*>(static_cast<const BTreeHashTable*>(this)->find_ptr(key));
+    }
+
+    // Wywoluje 'visit' dla kazdego elementu; w obrebie kubelka w kolejnosci rosnacych kluczy.
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const Bucket& bucket : table) {
+            if (bucket.generation == generation && bucket.root) {
+                for_each_tree(bucket.root, visit);
+            }
+        }
+    }
+
+    void display() override {
+        std::cout << "=== B-Tree Hash Table ===" << std::endl;
+        for (size_t i = 0; i < table.size(); ++i) {
+            std::cout << "Bucket " << i << ":" << std::endl;
+            if (live_root(i)) {
+                display_tree(live_root(i), 1);
+            }
+            else {
+                std::cout << "  [EMPTY]" << std::endl;
+            }
+        }
+        std::cout << "Total Size: " << current_size << " / Table Capacity: " << table_size << std::endl;
+    }
+
+    size_t size() const override { return current_size; }
+
+    // Obiekt, wektor korzeni i bloki obu aren (takze wolne sloty).
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(table.capacity() * sizeof(Bucket)) + leaves.capacity_bytes() +
+               inners.capacity_bytes();
+    }
+
+    // Liczone sa odczytane wezly (linie kluczy), nie porownania - wezel jest przeszukiwany naraz.
+    // Trafienie: glebokosc wezla z kluczem; chybienie: wysokosc drzewa kubelka (pusty kubelek - 0).
+    bool probe_stats(ProbeStats& stats) const override {
+        stats = ProbeStats();
+        if (table.empty()) return true;
+        double hit_total = 0;
+        double miss_total = 0;
+        for (const Bucket& bucket : table) {
+            if (bucket.generation != generation || !bucket.root) continue;
+            size_t height = 0;
+            probe_depths_tree(bucket.root, 0, hit_total, height);
+            miss_total += static_cast<double>(height);
+            stats.max_hit = std::max(stats.max_hit, height);
+        }
+        stats.average_hit = current_size ? hit_total / static_cast<double>(current_size) : 0.0;
+        stats.average_miss = miss_total / static_cast<double>(table_size);
+        return true;
+    }
+
+    // Dozwolony zakres: (0, LOAD_FACTOR_LIMIT].
+    bool set_max_load_factor(double value) override {
+        if (!(value > 0.0 && value <= LOAD_FACTOR_LIMIT)) return false;
+        max_load_factor = value;
+        while (!table.empty() && over_load_factor()) {
+            resize();
+        }
+        return true;
+    }
+
+    // Dozwolony zakres: (1, GROWTH_FACTOR_LIMIT].
+    bool set_growth_factor(double value) override {
+        if (!(value > 1.0 && value <= GROWTH_FACTOR_LIMIT)) return false;
+        growth_factor = value;
+        return true;
+    }
+
+    double get_max_load_factor() const override { return max_load_factor; }
+
+    double get_growth_factor() const override { return growth_factor; }
+
+    // Czysci tabele w czasie O(1): wezly wracaja naraz do aren, stare korzenie czytaja sie jako puste.
+    void clear() override {
+        clear(false);
+    }
+
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            leaves.release();
+            inners.release();
+            std::vector<Bucket>().swap(table);
+        }
+        else {
+            leaves.reset();
+            inners.reset();
+            if (++generation == 0) {
+                for (Bucket& bucket : table) {
+                    bucket = Bucket();
+                }
+                generation = 1;
+            }
+        }
+        current_size = 0;
+    }
+
+    std::string get_name() const override {
+        return "B-Tree Hash Table";
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h).
+inline const bool btree_hash_table_registered = register_engine({
+    "btree", "B-drzewa", "B-Tree", 35, 36.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new BTreeHashTable(std::max<size_t>(1, n))); },
+    false, 8.0 }); // Domyslnie 8 kluczy na kubelek - n kubelkow na n kluczy dawaloby prawie pusty lisc na kubelek
+
+#endif // BTREE_HASH_TABLE_H
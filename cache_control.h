@@ -0,0 +1,185 @@
+#ifndef CACHE_CONTROL_H
+#define CACHE_CONTROL_H
+
+#include <algorithm> // std::min, std::max
+#include <cstddef>   // size_t
+#include <cstdint>   // uint64_t
+#include <cstdlib>   // std::strtoull
+#include <fstream>   // Odczyt rozmiarow cache z sysfs
+#include <string>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>  // sysconf
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>  // malloc_trim
+#endif
+
+// Sterowanie stanem pamieci podrecznej przed mierzonymi seriami operacji.
+//
+// Tryb cieply (WARM): tabela i klucze zostaly wlasnie dotkniete, wiec pomiar pokazuje
+// koszt operacji na danych w cache. Tryb zimny (COLD): przed seria odczytywany jest bufor
+// wiekszy niz najwieksza pamiec podreczna, ktory wypiera z niej tabele - tak jak w
+// typowym programie, w ktorym miedzy kolejnymi dostepami do slownika dziala inny kod.
+
+// Tryb pamieci podrecznej w benchmarku.
+enum class CacheMode {
+    WARM, // Dane w cache (rozgrzane niemierzonym przebiegiem)
+    COLD  // Cache wyczyszczony buforem wypierajacym przed kazda seria
+};
+
+inline const char* cache_mode_name(CacheMode mode) {
+    return mode == CacheMode::COLD ? "cold" : "warm";
+}
+
+// Rozmiary pamieci podrecznych procesora w bajtach (0 - nieznany).
+struct CacheInfo {
+    size_t l1d = 0;
+    size_t l2 = 0;
+    size_t l3 = 0;
+
+    // Rozmiar najwiekszej znanej pamieci podrecznej.
+    size_t largest() const { return std::max(l1d, std::max(l2, l3)); }
+};
+
+// Odczytuje rozmiary cache: z sysfs (Linux), a gdy to sie nie uda - z sysconf.
+inline CacheInfo detect_cache_info() {
+    CacheInfo info;
+#ifdef __linux__
+    for (int index = 0; index < 8; ++index) {
+        std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+        std::ifstream level_file(dir + "level");
+        std::ifstream type_file(dir + "type");
+        std::ifstream size_file(dir + "size");
+        int level = 0;
+        std::string type;
+        std::string size_text;
+        if (!(level_file >> level) || !(type_file >> type) || !(size_file >> size_text)) {
+            break;
+        }
+        if (type == "Instruction") continue;
+        char* unit = nullptr;
+        size_t size = static_cast<size_t>(std::strtoull(size_text.c_str(), &unit, 10));
+        if (*unit == 'K') size <<= 10;
+        else if (*unit == 'M') size <<= 20;
+        if (level == 1) info.l1d = size;
+        else if (level == 2) info.l2 = size;
+        else if (level == 3) info.l3 = size;
+    }
+#endif
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    if (!info.l1d) info.l1d = static_cast<size_t>(std::max(0L, sysconf(_SC_LEVEL1_DCACHE_SIZE)));
+    if (!info.l2) info.l2 = static_cast<size_t>(std::max(0L, sysconf(_SC_LEVEL2_CACHE_SIZE)));
+    if (!info.l3) info.l3 = static_cast<size_t>(std::max(0L, sysconf(_SC_LEVEL3_CACHE_SIZE)));
+#endif
+    return info;
+}
+
+// Pamiec dostepna dla nowych alokacji bez wymiany na dysk: MemAvailable z /proc/meminfo
+// (Linux), w przeciwnym razie liczba wolnych stron z sysconf. 0 - nieznana.
+inline uint64_t available_memory_bytes() {
+#ifdef __linux__
+    std::ifstream meminfo("/proc/meminfo");
+    std::string name;
+    uint64_t kilobytes;
+    std::string unit;
+    while (meminfo >> name >> kilobytes >> unit) {
+        if (name == "MemAvailable:") {
+            return kilobytes * 1024;
+        }
+    }
+#endif
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+    long pages = sysconf(_SC_AVPHYS_PAGES);
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (pages > 0 && page_size > 0) {
+        return static_cast<uint64_t>(pages) * static_cast<uint64_t>(page_size);
+    }
+#endif
+    return 0;
+}
+
+// Pamiec rezydentna procesu (RSS) w bajtach: /proc/self/statm (Linux). 0 - nieznana.
+inline uint64_t resident_memory_bytes() {
+#if defined(__linux__) && defined(_SC_PAGESIZE)
+    std::ifstream statm("/proc/self/statm");
+    uint64_t total_pages = 0;
+    uint64_t resident_pages = 0;
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (statm >> total_pages >> resident_pages && page_size > 0) {
+        return resident_pages * static_cast<uint64_t>(page_size);
+    }
+#endif
+    return 0;
+}
+
+// Oddaje systemowi wolna pamiec sterty (glibc), aby RSS kolejnego pomiaru w tym samym procesie
+// nie zawieral pamieci zwolnionej przez poprzedni. Na innych platformach nic nie robi.
+inline void release_free_heap() {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+// Najmniejszy poziom pamieci, w ktorym miesci sie zbior roboczy.
+enum class MemoryRegime {
+    L1,
+    L2,
+    L3,
+    DRAM
+};
+
+inline const char* memory_regime_name(MemoryRegime regime) {
+    switch (regime) {
+    case MemoryRegime::L1: return "L1";
+    case MemoryRegime::L2: return "L2";
+    case MemoryRegime::L3: return "L3";
+    default: return "DRAM";
+    }
+}
+
+// Poziom dla zbioru roboczego 'bytes'; poziomy o nieznanym rozmiarze sa pomijane.
+inline MemoryRegime memory_regime(uint64_t bytes, const CacheInfo& info) {
+    if (info.l1d && bytes <= info.l1d) return MemoryRegime::L1;
+    if (info.l2 && bytes <= info.l2) return MemoryRegime::L2;
+    if (info.l3 && bytes <= info.l3) return MemoryRegime::L3;
+    return MemoryRegime::DRAM;
+}
+
+// Wypiera dane z pamieci podrecznej odczytujac bufor wiekszy od najwiekszego cache.
+// Bufor jest alokowany raz (w konstruktorze), kazde evict() przechodzi po nim cale.
+class CacheEvictor {
+private:
+    static constexpr size_t LINE = 64;                    // Rozmiar linii cache
+    static constexpr size_t DEFAULT_BYTES = 64u << 20;    // Gdy rozmiaru cache nie udalo sie odczytac
+    static constexpr size_t MAX_BYTES = 512u << 20;       // Gorny limit (maszyny wirtualne czasem
+                                                          // zglaszaja L3 calego hosta)
+
+    std::vector<uint64_t> buffer;
+    volatile uint64_t sink; // Suma odczytow - zapobiega usunieciu petli przez kompilator
+
+public:
+    // 'bytes' = 0: dwukrotnosc najwiekszego cache (z limitem MAX_BYTES).
+    explicit CacheEvictor(size_t bytes = 0) : sink(0) {
+        if (bytes == 0) {
+            size_t largest = detect_cache_info().largest();
+            bytes = largest ? std::min(2 * largest, MAX_BYTES) : DEFAULT_BYTES;
+        }
+        buffer.assign(bytes / sizeof(uint64_t), 1);
+    }
+
+    // Odczytuje po jednym slowie z kazdej linii bufora (zapis nie jest potrzebny - czyste
+    // linie sa wypierane bez kosztu zapisu do pamieci przy nastepnych dostepach tabeli).
+    void evict() {
+        const size_t stride = LINE / sizeof(uint64_t);
+        uint64_t sum = 0;
+        for (size_t i = 0; i < buffer.size(); i += stride) {
+            sum += buffer[i];
+        }
+        sink = sink + sum;
+    }
+
+    size_t bytes() const { return buffer.size() * sizeof(uint64_t); }
+};
+
+#endif // CACHE_CONTROL_H
@@ -3,108 +3,423 @@
 
 #include "hash_table_base.h"
 #include <vector> // Zmieniono z <list> na <vector>
+#include <algorithm> // std::max
+#include <cmath> // std::ceil - nowy rozmiar przy wzroscie
+#include <cstdint> // uint32_t dla licznika generacji, uint8_t dla znacznikow
+#include "cpu_dispatch.h" // Porownywanie kluczy i znacznikow hasha jadrami SIMD wybranymi dla procesora
+#include "engine_registry.h" // Rejestracja w benchmarkach i demonstracji
 
-// Implementacja 1: Hash Table z metodą lancuchowa (chaining)
-// Ale teraz z uzyciem std::vector zamiast std::list w kazdym "kubku"
-class ChainingHashTable : public HashTableBase {
-private:
+// Uklad lancucha AoS: pary (klucz, wartosc) obok siebie w jednym wektorze.
+// Jeden odczyt daje klucz i wartosc; porownanie SIMD przeglada klucze co drugi int.
+struct ChainAoS {
     struct KeyValue {
         int key;
         int value;
         KeyValue(int k, int v) : key(k), value(v) {}
     };
 
-    // Zmieniono std::list na std::vector w kazdym kubku
-    std::vector<std::vector<KeyValue>> table;
+    std::vector<KeyValue> entries;
+
+    size_t size() const { return entries.size(); }
+    int key(size_t i) const { return entries[i].key; }
+    int& value(size_t i) { return entries[i].value; }
+    const int& value(size_t i) const { return entries[i].value; }
+
+    // Pozycja klucza lub size().
+    size_t find(int k) const {
+        return find_pair_key(reinterpret_cast<const int*>(entries.data()), entries.size(), k);
+    }
+
+    void push_back(int k, int v) { entries.emplace_back(k, v); }
+    void erase(size_t i) { entries.erase(entries.begin() + i); }
+    void move_to_front(size_t i) {
+        KeyValue hit = entries[i];
+        std::copy_backward(entries.begin(), entries.begin() + i, entries.begin() + i + 1); // memmove
+        entries[0] = hit;
+    }
+    void swap_entries(size_t i, size_t j) { std::swap(entries[i], entries[j]); }
+    void clear() { entries.clear(); } // Pamiec wektora zostaje do ponownego uzycia
+
+    // Pamiec sterty zajmowana przez lancuch (bez samego obiektu lancucha).
+    size_t heap_bytes() const { return heap_block_bytes(entries.capacity() * sizeof(KeyValue)); }
+
+    static const char* layout_name() { return "Vector"; }
+};
+
+// Uklad lancucha SoA: klucze w jednym wektorze, wartosci w drugim.
+// Porownanie SIMD czyta tylko klucze (2x wiecej kluczy na linie cache niz w AoS),
+// kosztem wiekszego kubka (dwa wektory) i osobnego odczytu wartosci po trafieniu.
+struct ChainSoA {
+    std::vector<int> keys;
+    std::vector<int> values;
+
+    size_t size() const { return keys.size(); }
+    int key(size_t i) const { return keys[i]; }
+    int& value(size_t i) { return values[i]; }
+    const int& value(size_t i) const { return values[i]; }
+
+    size_t find(int k) const {
+        return find_int(keys.data(), keys.size(), k);
+    }
+
+    void push_back(int k, int v) {
+        keys.push_back(k);
+        values.push_back(v);
+    }
+    void erase(size_t i) {
+        keys.erase(keys.begin() + i);
+        values.erase(values.begin() + i);
+    }
+    void move_to_front(size_t i) {
+        int key = keys[i];
+        int value = values[i];
+        std::copy_backward(keys.begin(), keys.begin() + i, keys.begin() + i + 1);
+        std::copy_backward(values.begin(), values.begin() + i, values.begin() + i + 1);
+        keys[0] = key;
+        values[0] = value;
+    }
+    void swap_entries(size_t i, size_t j) {
+        std::swap(keys[i], keys[j]);
+        std::swap(values[i], values[j]);
+    }
+    void clear() {
+        keys.clear();
+        values.clear();
+    }
+
+    size_t heap_bytes() const {
+        return heap_block_bytes(keys.capacity() * sizeof(int)) + heap_block_bytes(values.capacity() * sizeof(int));
+    }
+
+    static const char* layout_name() { return "SoA"; }
+};
+
+// Kolejnosc elementow lancucha po trafieniu (find lub aktualizacja wartosci przez insert).
+// on_hit przesuwa element z pozycji 'pos' (i jego znacznik w 'tags', gdy lancuch ma znaczniki -
+// inaczej nullptr) i zwraca jego nowa pozycje. Przy skosnym rozkladzie dostepow polityki
+// adaptacyjne trzymaja gorace klucze na poczatku lancucha, gdzie sa znajdowane po 1-2 porownaniach.
+
+// Kolejnosc wstawiania (bez zmian przy trafieniu).
+struct InsertionOrder {
+    template <class Chain>
+    static size_t on_hit(Chain&, uint8_t*, size_t pos) { return pos; }
+    static const char* name() { return nullptr; }
+};
+
+// Move-to-front: trafiony element przechodzi na poczatek (przesuniecie pos elementow).
+// Szybko adaptuje sie do zmiany goracego zbioru, ale pojedynczy dostep do zimnego klucza
+// spycha wszystkie gorace o jedna pozycje.
+struct MoveToFront {
+    template <class Chain>
+    static size_t on_hit(Chain& chain, uint8_t* tags, size_t pos) {
+        if (pos == 0) return 0;
+        chain.move_to_front(pos);
+        if (tags) {
+            uint8_t tag = tags[pos];
+            std::copy_backward(tags, tags + pos, tags + pos + 1);
+            tags[0] = tag;
+        }
+        return 0;
+    }
+    static const char* name() { return "move-to-front"; }
+};
+
+// Transpozycja: trafiony element zamienia sie miejscem z poprzednikiem (O(1)). Wolniej sie
+// adaptuje, ale stabilniej trzyma gorace klucze z przodu przy pojedynczych zimnych dostepach.
+struct Transpose {
+    template <class Chain>
+    static size_t on_hit(Chain& chain, uint8_t* tags, size_t pos) {
+        if (pos == 0) return 0;
+        chain.swap_entries(pos, pos - 1);
+        if (tags) std::swap(tags[pos], tags[pos - 1]);
+        return pos - 1;
+    }
+    static const char* name() { return "transpose"; }
+};
+
+// Implementacja 1: Hash Table z metodą lancuchowa (chaining)
+// Ale teraz z uzyciem std::vector zamiast std::list w kazdym "kubku".
+// 'Chain' to uklad lancucha: ChainAoS (ChainingHashTable) lub ChainSoA (SoAChainingHashTable),
+// 'Order' - kolejnosc elementow po trafieniu: InsertionOrder, MoveToFront lub Transpose.
+template <class Chain, class Order = InsertionOrder>
+class BasicChainingHashTable : public HashTableBase {
+private:
+    // Kubek: lancuch elementow (zamiast std::list) i generacja, w ktorej byl ostatnio uzywany.
+    // Kubek z innej generacji jest traktowany jako pusty i czyszczony leniwie przy pierwszym dostepie.
+    struct Bucket {
+        Chain chain;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Bucket> table;
     size_t table_size;
     size_t current_size;
+    uint32_t generation; // Biezaca generacja tabeli (zwiekszana przez clear)
+    double max_load_factor; // Srednia dlugosc lancucha, po przekroczeniu ktorej tabela rosnie
+    double growth_factor; // Krotnosc wzrostu liczby kubkow przy resize()
+
+    // Znaczniki hasha dla dlugich lancuchow: tags[index][i] to 8-bitowy znacznik klucza
+    // table[index].chain.key(i). Szukanie porownuje 32 znaczniki jedna instrukcja SIMD i czyta
+    // klucze tylko tam, gdzie znacznik sie zgadza - dlugi lancuch przy skosnych kluczach
+    // nie wymaga wtedy N odczytow kluczy. Znaczniki sa utrzymywane tylko dla lancuchow
+    // o dlugosci >= TAG_SCAN_MIN_CHAIN, a cala tablica jest alokowana dopiero, gdy pojawi sie
+    // pierwszy taki lancuch - przy rownomiernych kluczach kubki zostaja male i nic nie kosztuje.
+    std::vector<std::vector<uint8_t>> tags;
+
+    // Zwraca kubek, czyszczac go najpierw, jesli pochodzi z poprzedniej generacji.
+    Bucket& bucket_at(size_t index) {
+        Bucket& bucket = table[index];
+        if (bucket.generation != generation) {
+            bucket.chain.clear();
+            bucket.generation = generation;
+        }
+        return bucket;
+    }
+
+    // Kubek do odczytu lub nullptr, jesli pochodzi z poprzedniej generacji (jest wtedy pusty).
+    // W przeciwienstwie do bucket_at niczego nie zapisuje - uzywany przez wyszukiwanie i display.
+    Bucket* live_bucket(size_t index) {
+        Bucket& bucket = table[index];
+        return bucket.generation == generation ? &bucket : nullptr;
+    }
+
+    const Bucket* live_bucket(size_t index) const {
+        const Bucket& bucket = table[index];
+        return bucket.generation == generation ? &bucket : nullptr;
+    }
+
+    // Znacznik klucza: najstarsze 8 bitow hasha (indeks kubka pochodzi z mlodszych bitow).
+    static uint8_t tag_of(unsigned int hash) {
+        return static_cast<uint8_t>(hash >> 24);
+    }
+
+    // Zwraca pozycje klucza w kubku lub chain.size(), jesli go nie ma.
+    // Najkrotsze lancuchy (typowe przy rownomiernych kluczach) sa przegladane zwykla petla -
+    // wywolanie jadra SIMD kosztowaloby tam wiecej niz 1-2 porownania. Ta czesc jest mala,
+    // aby kompilator wstawial ja w miejscu wywolania; dluzsze lancuchy obsluguje find_in_long_chain.
+    size_t find_in_bucket(size_t index, const Bucket& bucket, int key, uint8_t tag) const {
+        size_t count = bucket.chain.size();
+        if (count >= SIMD_SCAN_MIN_CHAIN) {
+            return find_in_long_chain(index, bucket, key, tag);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (bucket.chain.key(i) == key) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    // Srednie lancuchy porownuja 4-16 kluczy jedna instrukcja (SSE2/AVX2/AVX-512), a dlugie -
+    // grupy po 32 znaczniki, czytajac klucze tylko dla pasujacych znacznikow.
+    size_t find_in_long_chain(size_t index, const Bucket& bucket, int key, uint8_t tag) const {
+        size_t count = bucket.chain.size();
+        if (count < TAG_SCAN_MIN_CHAIN) {
+            return bucket.chain.find(key);
+        }
+        for (size_t base = 0; base < count; base += 32) {
+            size_t group = count - base < 32 ? count - base : 32;
+            unsigned int mask = match_bytes32(tags[index].data() + base, group, tag);
+            while (mask) {
+                size_t i = base + lowest_set_bit(mask);
+                if (bucket.chain.key(i) == key) {
+                    return i;
+                }
+                mask &= mask - 1; // Usun najmlodszy bit - nastepny kandydat
+            }
+        }
+        return count;
+    }
+
+    // Domyslny wspolczynnik obciazenia
+    static constexpr double DEFAULT_MAX_LOAD_FACTOR = 0.75;
+    // Gorna granica wspolczynnika (srednia dlugosc lancucha)
+    static constexpr double LOAD_FACTOR_LIMIT = 64.0;
+    static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
+    static constexpr double GROWTH_FACTOR_LIMIT = 4.0;
 
-    // Wspolczynnik obciazenia
-    static constexpr double MAX_LOAD_FACTOR = 0.75;
+    bool over_load_factor() const {
+        return static_cast<double>(current_size) / table_size > max_load_factor;
+    }
+
+    // Minimalna dlugosc lancucha, od ktorej klucze sa porownywane instrukcjami SIMD.
+    static constexpr size_t SIMD_SCAN_MIN_CHAIN = 4;
+
+    // Minimalna dlugosc lancucha, od ktorej szukanie korzysta ze znacznikow.
+    static constexpr size_t TAG_SCAN_MIN_CHAIN = 16;
+
+    // Przestawia trafiony element wg polityki Order; zwraca jego nowa pozycje.
+    size_t reorder_on_hit(size_t index, Bucket& bucket, size_t pos) {
+        uint8_t* bucket_tags = bucket.chain.size() >= TAG_SCAN_MIN_CHAIN ? tags[index].data() : nullptr;
+        return Order::on_hit(bucket.chain, bucket_tags, pos);
+    }
+
+    // Alokuje kubki przy pierwszym wstawieniu (pusta tabela nie zajmuje pamieci).
+    void ensure_allocated() {
+        if (table.empty()) {
+            if (table_size == 0) table_size = 1;
+            table.resize(table_size);
+        }
+    }
+
+    // Dopisuje znacznik nowego elementu lancucha; gdy lancuch wlasnie osiagnal
+    // TAG_SCAN_MIN_CHAIN, buduje znaczniki dla calego lancucha.
+    void push_tag(size_t index, const Bucket& bucket, uint8_t tag) {
+        size_t count = bucket.chain.size();
+        if (count < TAG_SCAN_MIN_CHAIN) {
+            return;
+        }
+        if (tags.empty()) {
+            tags.resize(table_size); // Pierwszy dlugi lancuch w tabeli
+        }
+        std::vector<uint8_t>& bucket_tags = tags[index];
+        if (count == TAG_SCAN_MIN_CHAIN) {
+            bucket_tags.clear();
+            for (size_t i = 0; i < count; ++i) {
+                bucket_tags.push_back(tag_of(mix_hash(bucket.chain.key(i))));
+            }
+        }
+        else {
+            bucket_tags.push_back(tag);
+        }
+    }
 
     void resize() {
-        size_t old_size = table_size;
         auto old_table = std::move(table);
+        tags.clear(); // Znaczniki zostana zbudowane na nowo przy ponownym wstawianiu
 
-        table_size *= 2;
+        size_t grown = static_cast<size_t>(std::ceil(table_size * growth_factor));
+        table_size = grown > table_size ? grown : table_size + 1;
         table.clear();
         table.resize(table_size);
         current_size = 0;
 
-        // Przepisz wszystkie elementy
-        for (const auto& chain : old_table) {
-            for (const auto& kv : chain) {
-                insert(kv.key, kv.value);
+        // Przepisz wszystkie elementy (tylko z kubkow biezacej generacji)
+        for (const auto& bucket : old_table) {
+            if (bucket.generation != generation) continue;
+            for (size_t i = 0; i < bucket.chain.size(); ++i) {
+                insert(bucket.chain.key(i), bucket.chain.value(i));
             }
         }
     }
 
 public:
-    explicit ChainingHashTable(size_t initial_size = 16)
-        : table_size(initial_size), current_size(0) {
-        table.resize(table_size);
+    // Kubki sa alokowane leniwie - dopiero przy pierwszym insert.
+    // Wartosci spoza dozwolonego zakresu sa ignorowane (patrz set_max_load_factor / set_growth_factor).
+    explicit BasicChainingHashTable(size_t initial_size = 16, double max_load_factor = DEFAULT_MAX_LOAD_FACTOR,
+                                    double growth_factor = DEFAULT_GROWTH_FACTOR)
+        : table_size(initial_size), current_size(0), generation(1),
+          max_load_factor(DEFAULT_MAX_LOAD_FACTOR), growth_factor(DEFAULT_GROWTH_FACTOR) {
+        set_max_load_factor(max_load_factor);
+        set_growth_factor(growth_factor);
     }
 
     bool insert(int key, int value) override {
+        ensure_allocated();
+
         // Sprawdz czy trzeba zwiekszyc rozmiar
-        if (static_cast<double>(current_size) / table_size > MAX_LOAD_FACTOR) {
+        if (over_load_factor()) {
             resize();
         }
 
-        size_t index = hash_function(key, table_size);
-        auto& chain = table[index]; // Teraz to jest std::vector<KeyValue>
+        unsigned int hash = mix_hash(key);
+        size_t index = hash % table_size;
+        Bucket& bucket = bucket_at(index);
+        uint8_t tag = tag_of(hash);
 
         // Sprawdz czy klucz juz istnieje
-        for (auto& kv : chain) {
-            if (kv.key == key) {
-                kv.value = value; // Aktualizuj wartosc
-                return true;
-            }
+        size_t pos = find_in_bucket(index, bucket, key, tag);
+        if (pos < bucket.chain.size()) {
+            bucket.chain.value(reorder_on_hit(index, bucket, pos)) = value; // Aktualizuj wartosc
+            return true;
         }
 
-        // Dodaj nowy element do wektora
-        chain.emplace_back(key, value);
+        // Dodaj nowy element do wektora (i jego znacznik, jesli lancuch jest dlugi)
+        bucket.chain.push_back(key, value);
+        push_tag(index, bucket, tag);
         current_size++;
         return true;
     }
 
 
     bool remove(int key) override {
-        size_t index = hash_function(key, table_size);
-        auto& chain = table[index]; // Teraz to jest std::vector<KeyValue>
+        if (table.empty()) return false; // Tabela jeszcze niezaalokowana
+
+        unsigned int hash = mix_hash(key);
+        size_t index = hash % table_size;
+        Bucket& bucket = bucket_at(index);
 
         // Szukaj elementu do usuniecia w wektorze
-        for (auto it = chain.begin(); it != chain.end(); ++it) {
-            if (it->key == key) {
-                // Usun element z wektora. erase() dla vectora moze byc kosztowne
-                // (przenoszenie wszystkich elementow za usunietym).
-                chain.erase(it);
-                current_size--;
-                return true;
-            }
+        size_t pos = find_in_bucket(index, bucket, key, tag_of(hash));
+        if (pos == bucket.chain.size()) {
+            return false;
         }
-        return false;
+
+        // Usun element z wektora. erase() dla vectora moze byc kosztowne
+        // (przenoszenie wszystkich elementow za usunietym).
+        if (bucket.chain.size() > TAG_SCAN_MIN_CHAIN) {
+            tags[index].erase(tags[index].begin() + pos); // Lancuch nadal dlugi - zachowaj znaczniki
+        }
+        bucket.chain.erase(pos);
+        current_size--;
+        return true;
     }
 
     bool find(int key, int& value) override {
-        size_t index = hash_function(key, table_size);
-        const auto& chain = table[index]; // Teraz to jest std::vector<KeyValue>
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Zwraca wskaznik do wartosci w wektorze kubka lub nullptr.
+    // Wskaznik jest wazny do najblizszego insert (push_back lub resize moga
+    // przeniesc elementy wektora) albo remove z tego samego kubka; przy adaptacyjnej
+    // kolejnosci (MoveToFront, Transpose) takze do nastepnego trafienia w tym kubku.
+    int* find_ptr(int key) override {
+        if (table.empty()) return nullptr; // Tabela jeszcze niezaalokowana
+
+        unsigned int hash = mix_hash(key);
+        size_t index = hash % table_size;
+        Bucket* bucket = live_bucket(index);
+        if (!bucket) return nullptr;
+
+        size_t pos = find_in_bucket(index, *bucket, key, tag_of(hash));
+        return pos < bucket->chain.size() ? &bucket->chain.value(reorder_on_hit(index, *bucket, pos)) : nullptr;
+    }
+
+    // Wersja const nie zmienia kolejnosci w kubku (takze przy MoveToFront i Transpose).
+    const int* find_ptr(int key) const override {
+        if (table.empty()) return nullptr; // Tabela jeszcze niezaalokowana
+
+        unsigned int hash = mix_hash(key);
+        size_t index = hash % table_size;
+        const Bucket* bucket = live_bucket(index);
+        if (!bucket) return nullptr;
+
+        size_t pos = find_in_bucket(index, *bucket, key, tag_of(hash));
+        return pos < bucket->chain.size() ? &bucket->chain.value(pos) : nullptr;
+    }
 
-        for (const auto& kv : chain) {
-            if (kv.key == key) {
-                value = kv.value;
-                return true;
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const auto& bucket : table) {
+            if (bucket.generation != generation) continue; // Kubek z poprzedniej generacji jest pusty
+            for (size_t i = 0; i < bucket.chain.size(); ++i) {
+                visit(bucket.chain.key(i), bucket.chain.value(i));
             }
         }
-        return false;
     }
 
     void display() override {
-        std::cout << "=== Chaining Hash Table (using std::vector for chains) ===" << std::endl; // Zmieniono nazwe dla jasnosci
-        for (size_t i = 0; i < table_size; ++i) {
+        std::cout << "=== " << get_name() << " ===" << std::endl;
+        for (size_t i = 0; i < table.size(); ++i) {
             std::cout << "Bucket " << i << ": ";
-            for (const auto& kv : table[i]) {
-                std::cout << "(" << kv.key << "," << kv.value << ") ";
+            if (const Bucket* bucket = live_bucket(i)) {
+                for (size_t j = 0; j < bucket->chain.size(); ++j) {
+                    std::cout << "(" << bucket->chain.key(j) << "," << bucket->chain.value(j) << ") ";
+                }
             }
             std::cout << std::endl;
         }
@@ -113,16 +428,105 @@ public:
 
     size_t size() const override { return current_size; }
 
+    // Obiekt, tablica kubkow, wektory lancuchow (takze zachowane po clear) i znaczniki.
+    size_t memory_usage() const override {
+        size_t bytes = sizeof(*this) + heap_block_bytes(table.capacity() * sizeof(Bucket)) +
+                       heap_block_bytes(tags.capacity() * sizeof(std::vector<uint8_t>));
+        for (const auto& bucket : table) {
+            bytes += bucket.chain.heap_bytes();
+        }
+        for (const auto& bucket_tags : tags) {
+            bytes += heap_block_bytes(bucket_tags.capacity());
+        }
+        return bytes;
+    }
+
+    // Elementy lancucha porownane przy szukaniu: trafienie na pozycji i to i + 1 porownan,
+    // chybienie - dlugosc lancucha (bez uwzglednienia porownan SIMD i znacznikow).
+    bool probe_stats(ProbeStats& stats) const override {
+        stats = ProbeStats();
+        if (table.empty()) return true;
+        double hit_total = 0;
+        double miss_total = 0;
+        for (const auto& bucket : table) {
+            if (bucket.generation != generation) continue; // Kubek z poprzedniej generacji jest pusty
+            double length = static_cast<double>(bucket.chain.size());
+            hit_total += length * (length + 1) / 2;
+            miss_total += length;
+            stats.max_hit = std::max(stats.max_hit, bucket.chain.size());
+        }
+        stats.average_hit = current_size ? hit_total / static_cast<double>(current_size) : 0.0;
+        stats.average_miss = miss_total / static_cast<double>(table_size);
+        return true;
+    }
+
+    // Dozwolony zakres: (0, LOAD_FACTOR_LIMIT].
+    bool set_max_load_factor(double value) override {
+        if (!(value > 0.0 && value <= LOAD_FACTOR_LIMIT)) return false;
+        max_load_factor = value;
+        while (!table.empty() && over_load_factor()) {
+            resize();
+        }
+        return true;
+    }
+
+    // Dozwolony zakres: (1, GROWTH_FACTOR_LIMIT].
+    bool set_growth_factor(double value) override {
+        if (!(value > 1.0 && value <= GROWTH_FACTOR_LIMIT)) return false;
+        growth_factor = value;
+        return true;
+    }
+
+    double get_max_load_factor() const override { return max_load_factor; }
+
+    double get_growth_factor() const override { return growth_factor; }
+
     void clear() override {
-        for (auto& chain : table) {
-            chain.clear(); // Wyczysc kazdy wektor
+        clear(false);
+    }
+
+    // Bez 'release_storage' czyszczenie jest O(1): nowa generacja uniewaznia wszystkie kubki,
+    // a ich wektory sa czyszczone leniwie (z zachowaniem pamieci) przy pierwszym dostepie.
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            std::vector<Bucket>().swap(table); // Zwolnij kubki
+            std::vector<std::vector<uint8_t>>().swap(tags);
+        }
+        else if (++generation == 0) {
+            // Licznik generacji sie przekrecil - wyczysc kubki naprawde
+            for (auto& bucket : table) {
+                bucket.chain.clear(); // Wyczysc kazdy lancuch
+                bucket.generation = 0;
+            }
+            generation = 1;
         }
         current_size = 0;
     }
 
     std::string get_name() const override {
-        return "Chaining Hash Table (Vector)"; // Zmieniono nazwe dla jasnosci
+        std::string layout = Chain::layout_name();
+        if (Order::name()) layout = layout + ", " + Order::name();
+        return "Chaining Hash Table (" + layout + ")";
     }
 };
 
+using ChainingHashTable = BasicChainingHashTable<ChainAoS>;    // Pary (klucz, wartosc) w jednym wektorze
+using SoAChainingHashTable = BasicChainingHashTable<ChainSoA>; // Klucze i wartosci w osobnych wektorach
+using MoveToFrontChainingHashTable = BasicChainingHashTable<ChainAoS, MoveToFront>; // Trafiony element na poczatek
+using TransposeChainingHashTable = BasicChainingHashTable<ChainAoS, Transpose>;     // Trafiony element o pozycje wyzej
+
+// Rejestracja w benchmarkach (engine_registry.h).
+inline const bool chaining_hash_table_registered = register_engine({
+    "chaining", "Lancuchowanie", "Chaining", 20, 102.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new ChainingHashTable(n)); } });
+inline const bool soa_chaining_hash_table_registered = register_engine({
+    "soa-chaining", "Lancuchowanie SoA", "Chaining (SoA)", 21, 186.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new SoAChainingHashTable(n)); } });
+inline const bool mtf_chaining_hash_table_registered = register_engine({
+    "mtf-chaining", "Lancuchowanie MTF", "Chaining (MTF)", 22, 102.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new MoveToFrontChainingHashTable(n)); } });
+inline const bool transpose_chaining_hash_table_registered = register_engine({
+    "transpose-chaining", "Lancuchowanie z transpozycja", "Chaining (transpose)", 23, 102.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new TransposeChainingHashTable(n)); } });
+
 #endif // CHAINING_HASH_TABLE_H
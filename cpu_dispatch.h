@@ -0,0 +1,132 @@
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+#include "simd_scan.h" // Jadra przeszukiwania kluczy i znacznikow
+#include "simd_hash.h" // Jadra hashowania wielu kluczy naraz
+#include <cctype>  // std::tolower
+#include <cstdlib> // std::getenv
+#include <string>  // Porownanie nazwy poziomu z HASH_TABLE_SIMD
+
+// Wybor jader SIMD w czasie dzialania. Program jest kompilowany raz (bez -mavx2), a ten sam
+// plik wykonywalny dziala na procesorach z AVX-512, z samym AVX2 i na starszych (SSE2/SSE4).
+// Przy pierwszym uzyciu wykrywane sa cechy procesora i wypelniana jest tablica wskaznikow
+// na funkcje (jak ifunc w bibliotekach systemowych) - pozniej kazde wywolanie to jeden
+// skok posredni, bez ponownego sprawdzania procesora.
+//
+// Zmienna srodowiskowa HASH_TABLE_SIMD (scalar, sse2, avx2, avx512) pozwala wymusic nizszy
+// poziom, np. aby na jednej maszynie porownac jadra; wyzszego niz wykryty nie da sie wymusic.
+struct CpuKernels {
+    SimdLevel level;          // Poziom, dla ktorego wybrano jadra
+    SimdLevel detected_level; // Poziom obslugiwany przez procesor
+    // Szukanie klucza w ciaglej tablicy kluczy (SoA, male tabele w obiekcie).
+    size_t (*find_int)(const int* keys, size_t count, int key);
+    // Szukanie klucza w tablicy par (klucz, wartosc) (AoS).
+    size_t (*find_pair_key)(const int* pairs, size_t count, int key);
+    // Pozycja klucza w posortowanej tablicy kluczy (wezly B-drzew).
+    size_t (*count_less_int)(const int* keys, size_t count, int key);
+    // Maska znacznikow rownych 'byte' w grupie do 32 bajtow.
+    unsigned int (*match_bytes32)(const unsigned char* bytes, size_t count, unsigned char byte);
+    // mix_hash dla wielu kluczy naraz.
+    void (*mix_hash_batch)(const int* keys, size_t count, unsigned int seed, unsigned int* out);
+};
+
+// Tablica jader dla danego poziomu SIMD.
+inline CpuKernels select_kernels(SimdLevel level, SimdLevel detected_level) {
+    CpuKernels kernels{ SimdLevel::SCALAR, detected_level,
+                        find_int_scalar, find_pair_key_scalar, count_less_int_scalar, match_bytes_scalar,
+                        mix_hash_batch_scalar };
+#ifdef HASH_TABLE_HAVE_SSE2
+    if (level >= SimdLevel::SSE2) {
+        kernels.level = SimdLevel::SSE2;
+        kernels.find_int = find_int_sse2;
+        kernels.find_pair_key = find_pair_key_sse2;
+        kernels.count_less_int = count_less_int_sse2;
+        kernels.match_bytes32 = match_bytes32_halves;
+        kernels.mix_hash_batch = mix_hash_batch_sse2;
+    }
+#endif
+#ifdef HASH_TABLE_HAVE_AVX
+    if (level >= SimdLevel::AVX2) {
+        kernels.level = SimdLevel::AVX2;
+        kernels.find_int = find_int_avx2;
+        kernels.find_pair_key = find_pair_key_avx2;
+        kernels.count_less_int = count_less_int_avx2;
+        kernels.match_bytes32 = match_bytes32_avx2;
+        kernels.mix_hash_batch = mix_hash_batch_avx2;
+    }
+    if (level >= SimdLevel::AVX512) {
+        kernels.level = SimdLevel::AVX512;
+        kernels.find_int = find_int_avx512;
+        kernels.find_pair_key = find_pair_key_avx512;
+        kernels.count_less_int = count_less_int_avx512;
+        kernels.mix_hash_batch = mix_hash_batch_avx512; // Znaczniki: 32 bajty AVX2 wystarcza
+    }
+#endif
+    return kernels;
+}
+
+// Poziom wykryty dla procesora, ewentualnie obnizony zmienna HASH_TABLE_SIMD.
+inline SimdLevel requested_simd_level(SimdLevel detected_level) {
+    const char* env = std::getenv("HASH_TABLE_SIMD");
+    if (!env) {
+        return detected_level;
+    }
+    std::string name(env);
+    for (auto& c : name) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    SimdLevel requested = detected_level;
+    if (name == "scalar") requested = SimdLevel::SCALAR;
+    else if (name == "sse2") requested = SimdLevel::SSE2;
+    else if (name == "avx2") requested = SimdLevel::AVX2;
+    else if (name == "avx512") requested = SimdLevel::AVX512;
+    return requested < detected_level ? requested : detected_level;
+}
+
+// Jadra wybrane dla tego procesora (wyznaczane raz, przy pierwszym wywolaniu).
+inline const CpuKernels& cpu_kernels() {
+    static const CpuKernels kernels = [] {
+        SimdLevel detected = detect_simd_level();
+        return select_kernels(requested_simd_level(detected), detected);
+    }();
+    return kernels;
+}
+
+// Opis wybranych jader do raportow benchmarku, np. "AVX2 (detected: AVX-512)".
+inline std::string cpu_kernels_description() {
+    const CpuKernels& kernels = cpu_kernels();
+    std::string text = simd_level_name(kernels.level);
+    if (kernels.level != kernels.detected_level) {
+        text += std::string(" (detected: ") + simd_level_name(kernels.detected_level) + ")";
+    }
+    return text;
+}
+
+// Funkcje wywolywane przez tabele - przekazuja wywolanie do wybranego jadra.
+
+// Zwraca indeks pierwszego wystapienia 'key' w keys[0..count) lub count.
+inline size_t find_int(const int* keys, size_t count, int key) {
+    return cpu_kernels().find_int(keys, count, key);
+}
+
+// Zwraca indeks pierwszej pary z kluczem 'key' w pairs[0..2*count) lub count.
+inline size_t find_pair_key(const int* pairs, size_t count, int key) {
+    return cpu_kernels().find_pair_key(pairs, count, key);
+}
+
+// Liczba kluczy mniejszych od 'key' w posortowanej rosnaco tablicy keys[0..count).
+inline size_t count_less_int(const int* keys, size_t count, int key) {
+    return cpu_kernels().count_less_int(keys, count, key);
+}
+
+// Maska pozycji w bytes[0..count) (count <= 32) rownych 'byte'.
+inline unsigned int match_bytes32(const unsigned char* bytes, size_t count, unsigned char byte) {
+    return cpu_kernels().match_bytes32(bytes, count, byte);
+}
+
+// out[i] = mix_hash(keys[i], seed) dla i < count.
+inline void mix_hash_batch(const int* keys, size_t count, unsigned int seed, unsigned int* out) {
+    cpu_kernels().mix_hash_batch(keys, count, seed, out);
+}
+
+#endif // CPU_DISPATCH_H
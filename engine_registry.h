@@ -0,0 +1,166 @@
+#ifndef ENGINE_REGISTRY_H
+#define ENGINE_REGISTRY_H
+
+#include "hash_table_base.h" // Interfejs tworzonych tabel
+#include <algorithm>  // std::stable_sort
+#include <cmath>      // std::ceil - pojemnosc dla liczby kluczy
+#include <functional> // Fabryki silnikow
+#include <memory>     // std::unique_ptr
+#include <string>
+#include <vector>
+
+// Rejestr silnikow (implementacji HashTableBase) uzywany przez benchmarki i demonstracje.
+// Kazdy naglowek z implementacja rejestruje ja sam, zmienna inicjalizowana statycznie:
+//
+//   inline const bool my_table_registered = register_engine({ "my-table", "Moja tabela",
+//       "My Table", 50, 32.0, [](size_t n) { return std::unique_ptr<HashTableBase>(new MyTable(n)); } });
+//
+// Dolaczenie naglowka wystarczy, aby nowa tabela pojawila sie w run_tests, w sterowniku
+// linii polecen i w demonstracji - bez kopiowania kodu pomiarow.
+//
+// Argument fabryki to pojemnosc w jednostkach silnika (kubelki, sloty) - jak w konstruktorach.
+// Silnik, ktorego domyslny wspolczynnik wypelnienia jest rozny od 1, podaje go w
+// default_load_factor; make_for_keys(n) tworzy wtedy tabele mieszczaca n kluczy bez wzrostu.
+//
+// Dekoratory (np. filtr Blooma) rejestruja funkcje opakowujaca; nazwa "<dekorator>-<silnik>"
+// tworzy dowolny zarejestrowany silnik opakowany dekoratorem.
+
+// Opis zarejestrowanego silnika.
+struct EngineInfo {
+    std::string name;         // Identyfikator w linii polecen, np. "chaining"
+    std::string label;        // Nazwa kolumny w pliku wynikow run_tests
+    std::string display_name; // Krotka nazwa w konsoli
+    int sort_key;             // Kolejnosc na liscie (inicjalizacja statyczna w roznych plikach jej nie ustala)
+    double bytes_per_entry;   // Przyblizona pamiec na element (do oceny zbioru roboczego i limitow pamieci)
+    std::function<std::unique_ptr<HashTableBase>(size_t)> make; // Tworzy tabele o danej pojemnosci
+    bool baseline = false;    // Punkt odniesienia (biblioteka standardowa)
+    double default_load_factor = 1.0; // Kluczy na jednostke pojemnosci przy domyslnych ustawieniach
+
+    // Tworzy tabele dla 'keys' kluczy przy domyslnym wspolczynniku wypelnienia silnika.
+    std::unique_ptr<HashTableBase> make_for_keys(size_t keys) const {
+        return make(static_cast<size_t>(std::ceil(static_cast<double>(keys) / default_load_factor)));
+    }
+};
+
+// Opis dekoratora opakowujacego inny silnik.
+struct EngineDecoratorInfo {
+    std::string name;         // Przedrostek nazwy, np. "bloom" dla "bloom-avl"
+    double extra_bytes_per_entry; // Pamiec dodawana przez dekorator na element
+    std::function<std::unique_ptr<HashTableBase>(std::unique_ptr<HashTableBase>, size_t)> wrap;
+};
+
+class EngineRegistry {
+private:
+    std::vector<EngineInfo> engine_list;
+    std::vector<EngineDecoratorInfo> decorator_list;
+
+    EngineRegistry() = default;
+
+public:
+    EngineRegistry(const EngineRegistry&) = delete;
+    EngineRegistry& operator=(const EngineRegistry&) = delete;
+
+    // Jedyna instancja - tworzona przy pierwszym uzyciu, wiec rejestracja podczas
+    // inicjalizacji statycznej innych plikow jest bezpieczna.
+    static EngineRegistry& instance() {
+        static EngineRegistry registry;
+        return registry;
+    }
+
+    // Dodaje silnik. Zwraca false, jesli nazwa jest juz zajeta.
+    bool add(EngineInfo info) {
+        if (find(info.name)) {
+            return false;
+        }
+        engine_list.push_back(std::move(info));
+        std::stable_sort(engine_list.begin(), engine_list.end(),
+                         [](const EngineInfo& a, const EngineInfo& b) { return a.sort_key < b.sort_key; });
+        return true;
+    }
+
+    // Dodaje dekorator. Zwraca false, jesli nazwa jest juz zajeta.
+    bool add_decorator(EngineDecoratorInfo info) {
+        for (const auto& decorator : decorator_list) {
+            if (decorator.name == info.name) return false;
+        }
+        decorator_list.push_back(std::move(info));
+        return true;
+    }
+
+    // Zarejestrowane silniki (bez wariantow z dekoratorami), uporzadkowane wg sort_key.
+    const std::vector<EngineInfo>& engines() const { return engine_list; }
+
+    const std::vector<EngineDecoratorInfo>& decorators() const { return decorator_list; }
+
+    // Silnik o podanej nazwie lub nullptr.
+    const EngineInfo* find(const std::string& name) const {
+        for (const auto& engine : engine_list) {
+            if (engine.name == name) return &engine;
+        }
+        return nullptr;
+    }
+
+    // Przyblizona pamiec na element silnika "nazwa" lub "dekorator-nazwa" (0 dla nieznanej nazwy).
+    double bytes_per_entry(const std::string& name) const {
+        if (const EngineInfo* engine = find(name)) {
+            return engine->bytes_per_entry;
+        }
+        for (const auto& decorator : decorator_list) {
+            std::string prefix = decorator.name + "-";
+            if (name.compare(0, prefix.size(), prefix) == 0) {
+                double inner = bytes_per_entry(name.substr(prefix.size()));
+                if (inner > 0) {
+                    return inner + decorator.extra_bytes_per_entry;
+                }
+            }
+        }
+        return 0.0;
+    }
+
+    // Tworzy silnik "nazwa" lub "dekorator-nazwa" dla 'keys' kluczy (make_for_keys);
+    // nullptr dla nieznanej nazwy.
+    std::unique_ptr<HashTableBase> create(const std::string& name, size_t keys) const {
+        if (const EngineInfo* engine = find(name)) {
+            return engine->make_for_keys(keys);
+        }
+        for (const auto& decorator : decorator_list) {
+            std::string prefix = decorator.name + "-";
+            if (name.compare(0, prefix.size(), prefix) == 0) {
+                std::unique_ptr<HashTableBase> inner = create(name.substr(prefix.size()), keys);
+                if (inner) {
+                    return decorator.wrap(std::move(inner), keys);
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    // Jak create, ale z jawna pojemnoscia silnika (argument fabryki, np. liczba kubelkow);
+    // dekoratory dostaja 'keys'. Nullptr dla nieznanej nazwy.
+    std::unique_ptr<HashTableBase> create_with_capacity(const std::string& name, size_t capacity, size_t keys) const {
+        if (const EngineInfo* engine = find(name)) {
+            return engine->make(capacity);
+        }
+        for (const auto& decorator : decorator_list) {
+            std::string prefix = decorator.name + "-";
+            if (name.compare(0, prefix.size(), prefix) == 0) {
+                std::unique_ptr<HashTableBase> inner = create_with_capacity(name.substr(prefix.size()), capacity, keys);
+                if (inner) {
+                    return decorator.wrap(std::move(inner), keys);
+                }
+            }
+        }
+        return nullptr;
+    }
+};
+
+// Skroty dla zmiennych rejestrujacych w naglowkach implementacji.
+inline bool register_engine(EngineInfo info) {
+    return EngineRegistry::instance().add(std::move(info));
+}
+
+inline bool register_engine_decorator(EngineDecoratorInfo info) {
+    return EngineRegistry::instance().add_decorator(std::move(info));
+}
+
+#endif // ENGINE_REGISTRY_H
@@ -0,0 +1,226 @@
+#ifndef FIXED_OPEN_ADDRESSING_HASH_TABLE_H
+#define FIXED_OPEN_ADDRESSING_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza funkcje mix_hash
+#include <array>   // Sloty przechowywane bezposrednio w obiekcie (bez sterty)
+#include <cstdlib> // std::abort - przerwanie budowania, ktore zgubiloby klucze
+#include <utility> // std::pair dla list inicjalizacyjnych
+
+// Tabela hashujaca z adresowaniem otwartym o stalej pojemnosci 'Capacity'.
+// Wariant OpenAddressingHashTable dla statycznych tablic wyszukiwania (np. ID protokolow,
+// mapy opcodow): sloty leza w std::array, wiec obiekt nie alokuje pamieci na stercie,
+// a budowanie i wyszukiwanie moga odbywac sie w kontekscie constexpr (w czasie kompilacji).
+//
+// Tabela nie dziedziczy po HashTableBase - klasy z metodami wirtualnymi nie moga byc
+// uzywane w constexpr (C++17). Interfejs (insert/remove/find/find_ptr/contains) jest jednak ten sam.
+//
+// Opcja hashowania doskonalego (build_perfect): szuka ziarna funkcji mix_hash, przy ktorym
+// wszystkie klucze trafiaja do roznych slotow. Wtedy find to jeden hash i jedno porownanie,
+// bez probkowania. Zalecana pojemnosc to co najmniej kilkukrotnosc liczby kluczy.
+template <size_t Capacity>
+class FixedOpenAddressingHashTable {
+    static_assert(Capacity > 0, "FixedOpenAddressingHashTable wymaga Capacity > 0");
+
+private:
+    // Pojedynczy slot. Usuwanie przesuwa wpisy wstecz (backward shift),
+    // wiec nie sa potrzebne znaczniki DELETED.
+    struct Slot {
+        int key = 0;
+        int value = 0;
+        bool occupied = false;
+    };
+
+    std::array<Slot, Capacity> slots{}; // Wszystkie sloty tabeli
+    size_t current_size = 0;            // Liczba zajetych slotow
+    unsigned int seed = 0;              // Ziarno funkcji hashujacej (0 = zwykly mix_hash)
+    bool perfect = true;                // true: kazdy klucz lezy w swoim slocie domowym
+
+    // Maksymalna liczba prob znalezienia ziarna w build_perfect.
+    static constexpr unsigned int MAX_PERFECT_SEED_ATTEMPTS = 4096;
+
+    // Slot domowy klucza dla biezacego ziarna.
+    constexpr size_t home(int key) const {
+        return static_cast<size_t>(mix_hash(key, seed)) % Capacity;
+    }
+
+    // Probkowanie liniowe: zwraca indeks slotu z kluczem lub pierwszego pustego slotu.
+    // Zwraca Capacity, jesli tabela jest pelna i klucza nie ma.
+    constexpr size_t probe(int key) const {
+        size_t index = home(key);
+        for (size_t step = 0; step < Capacity; ++step) {
+            if (!slots[index].occupied || slots[index].key == key) {
+                return index;
+            }
+            index = (index + 1) % Capacity;
+        }
+        return Capacity;
+    }
+
+    // Sprawdza, czy przy danym ziarnie wszystkie klucze maja rozne sloty domowe.
+    template <size_t N>
+    static constexpr bool is_collision_free(const std::pair<int, int>(&entries)[N], unsigned int candidate) {
+        std::array<bool, Capacity> used{};
+        std::array<int, Capacity> owner{};
+        for (size_t i = 0; i < N; ++i) {
+            size_t index = static_cast<size_t>(mix_hash(entries[i].first, candidate)) % Capacity;
+            if (used[index] && owner[index] != entries[i].first) {
+                return false; // Dwa rozne klucze w tym samym slocie
+            }
+            used[index] = true;
+            owner[index] = entries[i].first;
+        }
+        return true;
+    }
+
+    // Wstawienie podczas budowania. Niepowodzenie gubiloby klucz po cichu, dlatego przerywa
+    // budowanie: std::abort nie jest constexpr, wiec w kontekscie constexpr to blad kompilacji.
+    constexpr void insert_for_build(int key, int value) {
+        if (!insert(key, value)) {
+            std::abort();
+        }
+    }
+
+public:
+    constexpr FixedOpenAddressingHashTable() = default;
+
+    // Buduje tabele z listy par klucz-wartosc (probkowanie liniowe).
+    // Przy powtorzonym kluczu obowiazuje ostatnia wartosc. Wiecej par niz Capacity to blad kompilacji.
+    template <size_t N>
+    static constexpr FixedOpenAddressingHashTable build(const std::pair<int, int>(&entries)[N]) {
+        static_assert(N <= Capacity, "Za duzo kluczy dla pojemnosci tabeli");
+        FixedOpenAddressingHashTable result;
+        for (size_t i = 0; i < N; ++i) {
+            result.insert_for_build(entries[i].first, entries[i].second);
+        }
+        return result;
+    }
+
+    // Buduje tabele z funkcja hashujaca doskonala dla podanego zbioru kluczy.
+    // Jesli w MAX_PERFECT_SEED_ATTEMPTS probach nie uda sie znalezc ziarna bez kolizji,
+    // tabela jest budowana zwyklym probkowaniem; sprawdz wynik przez is_perfect()
+    // (np. static_assert), jesli wymagane jest wyszukiwanie bez probkowania.
+    template <size_t N>
+    static constexpr FixedOpenAddressingHashTable build_perfect(const std::pair<int, int>(&entries)[N]) {
+        static_assert(N <= Capacity, "Za duzo kluczy dla pojemnosci tabeli");
+        for (unsigned int candidate = 1; candidate <= MAX_PERFECT_SEED_ATTEMPTS; ++candidate) {
+            if (is_collision_free(entries, candidate)) {
+                FixedOpenAddressingHashTable result;
+                result.seed = candidate;
+                for (size_t i = 0; i < N; ++i) {
+                    result.insert_for_build(entries[i].first, entries[i].second);
+                }
+                return result;
+            }
+        }
+        return build(entries);
+    }
+
+    // Wstawia pare klucz-wartosc lub aktualizuje istniejaca wartosc.
+    // Zwraca false, jesli tabela jest pelna. Wstawienie klucza kolidujacego
+    // ze slotem domowym innego klucza wylacza tryb doskonaly.
+    constexpr bool insert(int key, int value) {
+        size_t index = probe(key);
+        if (index == Capacity) {
+            return false; // Tabela pelna
+        }
+        if (!slots[index].occupied) {
+            if (index != home(key)) {
+                perfect = false; // Klucz poza slotem domowym - find musi probkowac
+            }
+            slots[index].key = key;
+            slots[index].occupied = true;
+            current_size++;
+        }
+        slots[index].value = value;
+        return true;
+    }
+
+    // Usuwa element o podanym kluczu. Kolejne wpisy z tego samego klastra
+    // sa przesuwane wstecz, aby probkowanie nie wymagalo znacznikow DELETED.
+    constexpr bool remove(int key) {
+        size_t index = probe(key);
+        if (index == Capacity || !slots[index].occupied) {
+            return false;
+        }
+
+        size_t hole = index;
+        size_t next = (hole + 1) % Capacity;
+        // Pelna tabela nie ma pustego slotu konczacego klaster - ogranicz liczbe krokow
+        for (size_t step = 1; step < Capacity && slots[next].occupied; ++step) {
+            size_t next_home = home(slots[next].key);
+            // Przesun wpis, jesli jego slot domowy nie lezy cyklicznie w (hole, next]
+            bool in_range = hole <= next ? (hole < next_home && next_home <= next)
+                                         : (hole < next_home || next_home <= next);
+            if (!in_range) {
+                slots[hole] = slots[next];
+                hole = next;
+            }
+            next = (next + 1) % Capacity;
+        }
+        slots[hole] = Slot{};
+        current_size--;
+        return true;
+    }
+
+    // Zwraca wskaznik do wartosci lub nullptr. W trybie doskonalym sprawdzany jest
+    // tylko slot domowy. Wskaznik jest wazny do najblizszego insert/remove.
+    constexpr const int* find_ptr(int key) const {
+        if (perfect) {
+            const Slot& slot = slots[home(key)];
+            return slot.occupied && slot.key == key ? &slot.value : nullptr;
+        }
+        size_t index = probe(key);
+        return index != Capacity && slots[index].occupied ? &slots[index].value : nullptr;
+    }
+
+    constexpr int* find_ptr(int key) {
+        return const_cast<int*>(static_cast<const FixedOpenAddressingHashTable*>(this)->find_ptr(key));
+    }
+
+    // Znajduje wartosc skojarzona z kluczem i przypisuje ja do 'value'.
+    constexpr bool find(int key, int& value) const {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    constexpr bool contains(int key) const { return find_ptr(key) != nullptr; }
+
+    constexpr size_t size() const { return current_size; }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    // true, jesli kazdy klucz lezy w swoim slocie domowym (find bez probkowania).
+    constexpr bool is_perfect() const { return perfect; }
+
+    // Czyści tabele (wszystkie sloty na puste).
+    constexpr void clear() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots[i] = Slot{};
+        }
+        current_size = 0;
+        perfect = true; // Pusta tabela trywialnie spelnia warunek
+    }
+
+    // Wyswietla zawartosc tabeli (tylko w czasie wykonania).
+    void display() const {
+        std::cout << "=== Fixed Open Addressing Hash Table (capacity " << Capacity
+                  << (perfect ? ", perfect hash" : "") << ") ===" << std::endl;
+        for (size_t i = 0; i < Capacity; ++i) {
+            std::cout << "Index " << i << ": ";
+            if (slots[i].occupied) {
+                std::cout << "(" << slots[i].key << "," << slots[i].value << ")";
+            }
+            else {
+                std::cout << "[EMPTY]";
+            }
+            std::cout << std::endl;
+        }
+        std::cout << "Size: " << current_size << "/" << Capacity << std::endl;
+    }
+};
+
+#endif // FIXED_OPEN_ADDRESSING_HASH_TABLE_H
@@ -3,8 +3,44 @@
 
 #include <iostream>   // Do operacji wejscia/wyjscia (np. std::cout)
 #include <vector>     // Do uzycia dynamicznych tablic (std::vector)
+#include <string>     // Do zwracania nazwy implementacji (std::string)
+#include <functional> // Do przekazywania funkcji odwiedzajacej (std::function)
 
 
+// Mieszanie bitow klucza (multiply-xorshift), wspolne dla wszystkich implementacji.
+// Funkcja jest constexpr, aby mogly z niej korzystac takze tabele budowane w czasie kompilacji.
+// 'seed' pozwala wybrac inna funkcje z tej samej rodziny (uzywane przy hashowaniu doskonalym).
+constexpr unsigned int mix_hash(int key, unsigned int seed = 0) {
+    // Uzyj unsigned int dla operacji bitowych (obsluguje tez klucze ujemne)
+    unsigned int ukey = static_cast<unsigned int>(key) ^ (seed * 0x9e3779b9u);
+
+    // Popularna heurystyka haszujaca (np. z algorytmu Boba Jenkinsa, FNV, itp.)
+    // Ta konkretna jest prosta, ale skuteczniejsza niz samo modulo.
+    ukey = ((ukey >> 16) ^ ukey) * 0x45d9f3b; // Mnozenie i XOR z przesunieciem
+    ukey = ((ukey >> 16) ^ ukey) * 0x45d9f3b; // Powtorzenie dla lepszego rozproszenia
+    ukey = (ukey >> 16) ^ ukey;             // Koncowy XOR
+    return ukey;
+}
+
+// Przyblizony rozmiar bloku sterty zajmowanego przez alokacje 'bytes' bajtow (glibc malloc:
+// 8 bajtow naglowka, zaokraglenie do 16, co najmniej 32 bajty). Uzywane przez memory_usage() -
+// przy wielu malych alokacjach (wezly, krotkie wektory kubkow) narzut alokatora jest znaczny.
+inline size_t heap_block_bytes(size_t bytes) {
+    if (bytes == 0) return 0;
+    size_t block = (bytes + sizeof(void*) + 15) & ~static_cast<size_t>(15);
+    return block < 32 ? 32 : block;
+}
+
+// Statystyki dlugosci probkowania: ile kluczy (slotow, elementow lancucha, wezlow drzewa)
+// trzeba porownac, aby znalezc klucz lub stwierdzic jego brak. Rosnace wartosci przy stalej
+// liczbie elementow oznaczaja degradacje (np. usuniete sloty w adresowaniu otwartym).
+struct ProbeStats {
+    double average_hit = 0;  // Srednia dla kluczy obecnych w tabeli
+    double average_miss = 0; // Srednia dla nieobecnych (kubek/slot poczatkowy wybrany rownomiernie)
+    size_t max_hit = 0;      // Najdluzsza sciezka do obecnego klucza
+    size_t tombstones = 0;   // Sloty oznaczone jako usuniete (tylko adresowanie otwarte)
+};
+
 // Abstrakcyjna klasa bazowa dla wszystkich implementacji tabeli hashujacej
 class HashTableBase {
 public:
@@ -30,6 +66,26 @@ public:
     // Zwraca 'true', jesli klucz zostal znaleziony, 'false' w przeciwnym razie.
     virtual bool find(int key, int& value) = 0;
 
+    // Czysto wirtualna metoda zwracajaca wskaznik do wartosci skojarzonej z kluczem
+    // lub nullptr, jesli klucza nie ma w tabeli. Pozwala odczytac lub zmodyfikowac
+    // wartosc w miejscu (read-modify-write) przy jednym przejsciu po tabeli,
+    // bez kopiowania wartosci. Waznosc wskaznika opisuje kazda implementacja.
+    virtual int* find_ptr(int key) = 0;
+
+    // Wersja const: samo wyszukiwanie, ktore niczego w tabeli nie zapisuje. Tabele adaptacyjne
+    // (move-to-front, transpose, splay) przestawiaja elementy tylko w wersji nie-const, wiec
+    // wiele watkow moze jednoczesnie szukac przez const HashTableBase&.
+    virtual const int* find_ptr(int key) const = 0;
+
+    // Zwraca 'true', jesli klucz znajduje sie w tabeli (bez kopiowania wartosci).
+    bool contains(int key) const {
+        return find_ptr(key) != nullptr;
+    }
+
+    // Czysto wirtualna metoda wywolujaca 'visit(klucz, wartosc)' dla kazdego elementu tabeli
+    // (kolejnosc nieokreslona). Tabeli nie wolno modyfikowac w trakcie przegladania.
+    virtual void for_each(const std::function<void(int, int)>& visit) const = 0;
+
     // Czysto wirtualna metoda do wyswietlania zawartosci tabeli hashujacej.
     virtual void display() = 0;
 
@@ -37,28 +93,59 @@ public:
     virtual size_t size() const = 0;
 
     // Czysto wirtualna metoda do czyszczenia (usuwania wszystkich elementow) tabeli.
-    virtual void void clear() = 0; // Poprawka: powinno byc void, a nie void void
+    virtual void clear() = 0;
+
+    // Liczy statystyki probkowania przegladajac cala tabele (O(pojemnosc) - do raportow, nie do
+    // goracej sciezki). Zwraca false, gdy implementacja ich nie udostepnia.
+    virtual bool probe_stats(ProbeStats& stats) const {
+        (void)stats;
+        return false;
+    }
+
+    // Czysto wirtualna metoda zwracajaca przyblizona pamiec zajmowana przez tabele w bajtach:
+    // obiekt, zaalokowana pojemnosc (nie tylko uzyte elementy) i narzut alokatora (heap_block_bytes).
+    virtual size_t memory_usage() const = 0;
+
+    // Ustawia maksymalny wspolczynnik wypelnienia (elementy / kubki), po przekroczeniu ktorego
+    // tabela rosnie. Nizszy - szybsze operacje kosztem pamieci. Jesli tabela jest juz
+    // bardziej wypelniona, od razu rosnie. Zwraca false, gdy implementacja nie ma
+    // wspolczynnika wypelnienia lub wartosc jest poza dozwolonym zakresem.
+    virtual bool set_max_load_factor(double max_load_factor) {
+        (void)max_load_factor;
+        return false;
+    }
+
+    // Ustawia krotnosc wzrostu tabeli przy przekroczeniu wspolczynnika (np. 2.0 lub 1.5).
+    // Mniejsza - mniej niewykorzystanej pamieci po wzroscie, ale czestsze przebudowy.
+    // Zwraca false, gdy implementacja tego nie obsluguje lub wartosc jest poza zakresem.
+    virtual bool set_growth_factor(double growth_factor) {
+        (void)growth_factor;
+        return false;
+    }
+
+    // Biezacy maksymalny wspolczynnik wypelnienia; 0, gdy implementacja go nie ma.
+    virtual double get_max_load_factor() const { return 0.0; }
+
+    // Biezaca krotnosc wzrostu; 0, gdy implementacja jej nie ma.
+    virtual double get_growth_factor() const { return 0.0; }
+
+    // Czysci tabele; przy 'release_storage' == true zwalnia takze pamiec kubelkow,
+    // ktora zostanie ponownie zaalokowana dopiero przy nastepnym wstawieniu.
+    // Domyslnie zachowuje sie jak clear().
+    virtual void clear(bool release_storage) {
+        (void)release_storage;
+        clear();
+    }
 
 
 protected:
     
     // Algorytm:
-    // 1. Bierze bezwzgledna wartosc klucza (aby obsluzyc klucze ujemne).
-    // 2. Mnozy klucz przez duza liczbe pierwsza (np. 2654435761ULL - popularna wartosc).
-    // 3. Wykonuje operacje XOR z przesunieciem bitowym (pomaga rozproszyc bity).
-    // 4. Wynik rzutuje na size_t, a nastepnie wykonuje operacje modulo przez rozmiar tabeli.
+    // 1. Miesza bity klucza funkcja mix_hash (mnozenie i XOR z przesunieciem bitowym).
+    // 2. Wynik rzutuje na size_t, a nastepnie wykonuje operacje modulo przez rozmiar tabeli.
     size_t hash_function(int key, size_t table_size) const {
-        // Upewnij sie, ze klucz jest dodatni, aby uniknac problemow z modulo dla ujemnych liczb
-        unsigned int ukey = static_cast<unsigned int>(key); // Uzyj unsigned int dla operacji bitowych
-
-        // Popularna heurystyka haszujaca (np. z algorytmu Boba Jenkinsa, FNV, itp.)
-        // Ta konkretna jest prosta, ale skuteczniejsza niz samo modulo.
-        ukey = ((ukey >> 16) ^ ukey) * 0x45d9f3b; // Mnozenie i XOR z przesunieciem
-        ukey = ((ukey >> 16) ^ ukey) * 0x45d9f3b; // Powtorzenie dla lepszego rozproszenia
-        ukey = (ukey >> 16) ^ ukey;             // Koncowy XOR
-
         // Zawsze zwroc wynik modulo table_size, aby dopasowac do zakresu tablicy
-        return static_cast<size_t>(ukey) % table_size;
+        return static_cast<size_t>(mix_hash(key)) % table_size;
     }
 };
 
@@ -0,0 +1,128 @@
+#ifndef KEY_GENERATOR_H
+#define KEY_GENERATOR_H
+
+#include <cmath>   // std::exp, std::log, std::log1p, std::expm1
+#include <cstdint> // uint32_t, uint64_t
+#include <string>  // Nazwy rozkladow
+
+// Generatory kluczy dla benchmarkow. Klucze nie sa trzymane w tablicach: i-ty klucz zbioru
+// jest wyliczany z indeksu, dzieki czemu przebiegi do 10^9 kluczy nie potrzebuja
+// dodatkowych gigabajtow pamieci na same dane testowe.
+
+// Szybki generator pseudolosowy SplitMix64 (maly stan, dobra jakosc dla benchmarkow).
+class SplitMix64 {
+private:
+    uint64_t state;
+
+public:
+    explicit SplitMix64(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    // Liczba z zakresu [0, n) (n > 0).
+    uint64_t below(uint64_t n) { return next() % n; }
+
+    // Liczba z zakresu [0, 1).
+    double uniform() { return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0); }
+};
+
+// Generator rang o rozkladzie Zipfa: ranga k (0 = najczestsza) wypada z prawdopodobienstwem
+// proporcjonalnym do 1 / (k + 1)^s. Metoda rejection-inversion (Hormann, Derflinger) ma
+// stala pamiec i czas, wiec dziala takze dla n rzedu 10^9 (bez tablicy prawdopodobienstw).
+class ZipfGenerator {
+private:
+    uint64_t n;
+    double s;
+    double h_integral_x1;
+    double h_integral_n;
+    double threshold;
+
+    // log(1 + x) / x oraz (exp(x) - 1) / x, stabilne numerycznie w poblizu zera.
+    static double log1p_over_x(double x) {
+        return std::fabs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+    }
+    static double expm1_over_x(double x) {
+        return std::fabs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+    }
+
+    double h(double x) const { return std::exp(-s * std::log(x)); }
+
+    double h_integral(double x) const {
+        double log_x = std::log(x);
+        return expm1_over_x((1.0 - s) * log_x) * log_x;
+    }
+
+    double h_integral_inverse(double x) const {
+        double t = x * (1.0 - s);
+        if (t < -1.0) t = -1.0; // Ochrona przed bledem zaokraglenia
+        return std::exp(log1p_over_x(t) * x);
+    }
+
+public:
+    // 'n' - liczba rang (> 0), 's' - wykladnik (> 0; YCSB uzywa 0.99).
+    ZipfGenerator(uint64_t n, double s)
+        : n(n), s(s) {
+        h_integral_x1 = h_integral(1.5) - 1.0;
+        h_integral_n = h_integral(static_cast<double>(n) + 0.5);
+        threshold = 2.0 - h_integral_inverse(h_integral(2.5) - h(2.0));
+    }
+
+    // Losuje range z zakresu [0, n).
+    uint64_t next(SplitMix64& rng) const {
+        for (;;) {
+            double u = h_integral_n + rng.uniform() * (h_integral_x1 - h_integral_n);
+            double x = h_integral_inverse(u);
+            double k = std::floor(x + 0.5);
+            if (k < 1.0) k = 1.0;
+            else if (k > static_cast<double>(n)) k = static_cast<double>(n);
+            if (k - x <= threshold || u >= h_integral(k + 0.5) - h(k)) {
+                return static_cast<uint64_t>(k) - 1;
+            }
+        }
+    }
+};
+
+// Rozklad wyboru kluczy w benchmarku.
+enum class KeyDistribution {
+    UNIFORM,    // Klucze rozrzucone po calym zakresie int, wybierane rownomiernie
+    SEQUENTIAL, // Klucze 0, 1, 2, ... w kolejnosci
+    ZIPF        // Klucze rozrzucone jak UNIFORM, wybierane wg rozkladu Zipfa (goraca czesc)
+};
+
+inline const char* key_distribution_name(KeyDistribution distribution) {
+    switch (distribution) {
+    case KeyDistribution::SEQUENTIAL: return "sequential";
+    case KeyDistribution::ZIPF: return "zipf";
+    default: return "uniform";
+    }
+}
+
+// Zamienia nazwe rozkladu na wartosc; zwraca false dla nieznanej nazwy.
+inline bool parse_key_distribution(const std::string& name, KeyDistribution& distribution) {
+    if (name == "uniform") distribution = KeyDistribution::UNIFORM;
+    else if (name == "sequential") distribution = KeyDistribution::SEQUENTIAL;
+    else if (name == "zipf") distribution = KeyDistribution::ZIPF;
+    else return false;
+    return true;
+}
+
+// i-ty klucz zbioru. Dla UNIFORM/ZIPF indeks jest mieszany bijekcja na 32 bitach
+// (mnozenie przez liczbe nieparzysta i XOR z przesunieciem sa odwracalne), wiec rozne
+// indeksy daja rozne klucze, a klucze z indeksow >= n sluza jako gwarantowane chybienia.
+inline int key_at(uint64_t index, KeyDistribution distribution) {
+    uint32_t x = static_cast<uint32_t>(index);
+    if (distribution != KeyDistribution::SEQUENTIAL) {
+        x *= 0x9e3779b1u;
+        x ^= x >> 15;
+        x *= 0x85ebca77u;
+        x ^= x >> 13;
+    }
+    return static_cast<int>(x);
+}
+
+#endif // KEY_GENERATOR_H
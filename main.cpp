@@ -7,11 +7,27 @@
 #include <fstream> // Do zapisu wynikow do pliku
 #include <iomanip> // Do formatowania wyjscia
 #include <limits>  // Do std::numeric_limits
+#include <sstream> // Do formatowania przedzialow ufnosci
 
 #include "hash_table_base.h" // Bazowa klasa dla tabeli hashujacej
 #include "chaining_hash_table.h" // Implementacja z lancuchowaniem
 #include "open_addressing_hash_table.h" // Implementacja z adresowaniem otwartym
 #include "avl_hash_table.h" // Implementacja z lancuchowaniem i drzewami AVL
+#include "btree_hash_table.h" // Kubelki z B-drzewami o wezlach w liniach cache
+#include "splay_hash_table.h" // Kubelki z drzewami splay (gorace klucze w korzeniach)
+#include "wavl_hash_table.h" // Kubelki z drzewami weak AVL (O(1) rotacji na operacje)
+#include "fixed_open_addressing_hash_table.h" // Tabela o stalej pojemnosci (constexpr, bez sterty)
+#include "static_perfect_hash_table.h" // Statyczna tabela z minimalnym hashowaniem doskonalym
+#include "small_hash_table.h" // Tabela z elementami trzymanymi w obiekcie dla malych rozmiarow
+#include "bloom_filtered_hash_table.h" // Filtr Blooma przed dowolna tabela (szybkie chybienia)
+#include "cpu_dispatch.h" // Jadra SIMD wybrane dla procesora (raportowane w wynikach)
+#include "precision_timer.h" // Zegar rdtscp z kalibracja i odejmowaniem kosztu pomiaru
+#include "benchmark_stats.h" // Mediana, MAD i przedzialy ufnosci wynikow
+#include "cache_control.h" // Tryby cieplego i zimnego cache w benchmarkach
+#include "std_adapters.h" // Kontenery biblioteki standardowej jako punkt odniesienia
+#include "engine_registry.h" // Silniki zarejestrowane przez dolaczone naglowki
+#include "benchmark_driver.h" // Nieinteraktywny sterownik benchmarkow (argumenty linii polecen)
+#include "recording_hash_table.h" // Nagrywanie operacji tabeli do pliku zapisu (trace)
 
 
 
@@ -20,52 +36,111 @@ private:
     // Ten tester bedzie generowal klucze/wartosci dla konkretnego przebiegu testu.
     // Jest tworzony dla kazdego testu, wiec zestaw danych jest swiezy.
 
+    // Wypisuje mediane czasu operacji z 95% przedzialem ufnosci i przyspieszenie wzgledem
+    // mediany kazdego silnika odniesienia (> 1 - szybciej niz biblioteka standardowa, < 1 - wolniej).
+    static void print_with_speedup(const std::string& name, const SampleSummary& stats,
+                                   const std::vector<const EngineInfo*>& baselines,
+                                   const std::vector<double>& baseline_ns) {
+        const double ns = stats.median;
+        std::ostringstream interval;
+        interval << std::fixed << std::setprecision(2) << "[" << stats.ci_low << ", " << stats.ci_high << "]";
+        std::cout << "    " << std::left << std::setw(32) << name << std::right << std::setw(10) << ns << " ns "
+                  << std::left << std::setw(18) << interval.str() << std::right;
+        if (ns > 0) {
+            for (size_t b = 0; b < baselines.size(); ++b) {
+                std::cout << (b == 0 ? "   speedup vs " : ", vs ") << baselines[b]->display_name << ": "
+                          << baseline_ns[b] / ns << "x";
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // Jeden wiersz pliku statystyk.
+    static void write_stats_row(std::ofstream& out, int size, CacheMode mode, const EngineInfo& engine,
+                                const char* operation, const SampleSummary& stats) {
+        out << size << "\t" << cache_mode_name(mode) << "\t" << engine.label << "\t" << operation << "\t"
+            << stats.count << "\t" << stats.mean << "\t" << stats.median << "\t" << stats.mad << "\t"
+            << stats.ci_low << "\t" << stats.ci_high << "\t" << stats.outliers << "\n";
+    }
+
 public:
     // Ta metoda przyjmuje teraz parametry dla przebiegu testu
     void run_tests(
         const std::vector<int>& sizes, // Rozmiary tabel do testowania
         int num_data_sets, // Liczba zestawow danych dla kazdego rozmiaru
         int repetitions, // Liczba powtorzen dla kazdego zestawu danych
-        const std::string& output_filename = "wyniki.xlsx" // Nazwa pliku wyjsciowego
+        const std::string& output_filename = "wyniki.xlsx", // Nazwa pliku wyjsciowego
+        const std::vector<CacheMode>& cache_modes = { CacheMode::WARM, CacheMode::COLD } // Tryby pamieci podrecznej
     ) {
         std::cout << "\n=== STARTING PERFORMANCE TESTS ===" << std::endl;
+        std::cout << "SIMD kernels: " << cpu_kernels_description() << std::endl;
+        const PrecisionTimer& timer = precision_timer(); // Pomiar serii operacji (rdtscp lub zegar systemowy)
+        std::cout << "Timer: " << timer.description() << std::endl;
         auto full_time_start = std::chrono::high_resolution_clock::now(); // Czas rozpoczecia calego testu
 
+        // Wszystkie zarejestrowane silniki (engine_registry.h); przyspieszenie jest liczone
+        // wzgledem silnikow oznaczonych jako punkt odniesienia.
+        const std::vector<EngineInfo>& engines = EngineRegistry::instance().engines();
+        std::vector<const EngineInfo*> baselines;
+        std::vector<size_t> baseline_indices;
+        for (size_t e = 0; e < engines.size(); ++e) {
+            if (engines[e].baseline) {
+                baselines.push_back(&engines[e]);
+                baseline_indices.push_back(e);
+            }
+        }
+
+        // Bufor wypierajacy cache dla trybu zimnego (alokowany raz dla calego testu)
+        std::unique_ptr<CacheEvictor> evictor;
+        if (std::find(cache_modes.begin(), cache_modes.end(), CacheMode::COLD) != cache_modes.end()) {
+            evictor = std::make_unique<CacheEvictor>();
+            std::cout << "Cold-cache eviction buffer: " << (evictor->bytes() >> 20) << " MiB" << std::endl;
+        }
+
         std::ofstream outFile(output_filename); // Otworz plik do zapisu wynikow
-        // Zaktualizowany naglowek pliku wyjsciowego, bez kolumn wyszukiwania
-        outFile << "Rozmiar\tAdresowanie otwarte Wstawianie (ns)\tLancuchowanie Wstawianie (ns)\tAVL Wstawianie (ns)\t"
-            << "Adresowanie otwarte Usuwanie (ns)\tLancuchowanie Usuwanie (ns)\tAVL Usuwanie (ns)\n";
+        if (!outFile.is_open()) { // Sprawdzane przed pomiarami, aby blad nazwy nie zmarnowal przebiegu
+            std::cerr << "Error: cannot open " << output_filename << std::endl;
+            return;
+        }
+        // Naglowek: dla kazdego trybu cache najpierw kolumny wstawiania dla wszystkich silnikow, potem usuwania
+        outFile << "Rozmiar";
+        for (CacheMode mode : cache_modes) {
+            const char* mode_label = mode == CacheMode::COLD ? "zimny cache" : "cieply cache";
+            for (const auto& engine : engines) outFile << "\t" << engine.label << " Wstawianie " << mode_label << " (ns)";
+            for (const auto& engine : engines) outFile << "\t" << engine.label << " Usuwanie " << mode_label << " (ns)";
+        }
+        outFile << "\n";
+
+        // Statystyki kazdej komorki (mediana, MAD, przedzial ufnosci) w osobnym pliku, po jednym wierszu
+        size_t extension = output_filename.rfind('.');
+        if (extension != std::string::npos && output_filename.find_first_of("/\\", extension) != std::string::npos) {
+            extension = std::string::npos; // Kropka w nazwie katalogu, nie rozszerzenie
+        }
+        std::string stats_filename = output_filename.substr(0, extension) + "_statystyki.tsv";
+        std::ofstream statsFile(stats_filename);
+        if (!statsFile.is_open()) {
+            std::cerr << "Error: cannot open " << stats_filename << std::endl;
+            return;
+        }
+        statsFile << "Rozmiar\tTryb cache\tSilnik\tOperacja\tProbki\tSrednia (ns)\tMediana (ns)\tMAD (ns)"
+                  << "\tPU95 dolna (ns)\tPU95 gorna (ns)\tOdrzucone\n";
 
         for (int size : sizes) { // Petla po roznych rozmiarach tabel
             std::cout << "Testing for size: " << size << std::endl;
 
-            // Zmienne do akumulowania srednich czasow
-            double avg_open_insert = 0;
-            double avg_chaining_insert = 0;
-            double avg_avl_insert = 0;
-            double avg_open_remove = 0;
-            double avg_chaining_remove = 0;
-            double avg_avl_remove = 0;
-            // Usunieto deklaracje zmiennych dla czasow wyszukiwania
+            // Sumy czasow (srednie po zestawach danych i powtorzeniach) dla kazdego trybu i silnika
+            std::vector<std::vector<double>> avg_insert(cache_modes.size(), std::vector<double>(engines.size(), 0.0));
+            std::vector<std::vector<double>> avg_remove(cache_modes.size(), std::vector<double>(engines.size(), 0.0));
+            // Pojedyncze pomiary (ns na operacje) dla median i przedzialow ufnosci
+            std::vector<std::vector<std::vector<double>>> insert_samples(cache_modes.size(), std::vector<std::vector<double>>(engines.size()));
+            std::vector<std::vector<std::vector<double>>> remove_samples(cache_modes.size(), std::vector<std::vector<double>>(engines.size()));
 
             for (int data_set_idx = 0; data_set_idx < num_data_sets; ++data_set_idx) { // Petla po zestawach danych
                 std::cout << "  Data Set " << data_set_idx + 1 << " of " << num_data_sets << std::endl;
 
                 std::random_device rd; // Uzyj sprzetowego generatora liczb losowych
-                std::mt19937 gen(rd()); // Mersenne Twister jako generator
-                std::uniform_int_distribution<> dis_keys(1, size * 10); // Dystrybucja dla kluczy
-                std::uniform_int_distribution<> dis_values(1, 1000); // Dystrybucja dla wartosci
-
-                std::vector<int> keys(size); // Wektor na klucze
-                std::vector<int> values(size); // Wektor na wartosci
-
-                for (int i = 0; i < size; ++i) { // Generuj klucze i wartosci
-                    keys[i] = dis_keys(gen);
-                    values[i] = dis_values(gen);
-                }
 
                 for (int rep_idx = 0; rep_idx < repetitions; ++rep_idx) { // Petla po powtorzeniach
-                    // Utworz nowe instancje dla kazdego powtorzenia, aby zapewnic czysty stan
                     // Uzyj unikalnego seeda dla kazdego powtorzenia, aby zapewnic rozne dane dla kazdego przebiegu
                     std::mt19937 rep_gen(rd() + rep_idx);
                     std::uniform_int_distribution<> rep_dis_keys(1, size * 10);
@@ -76,100 +151,166 @@ public:
                         current_keys[i] = rep_dis_keys(rep_gen);
                     }
 
-                    ChainingHashTable chaining_ht(size); // Inicjalizuj tabele z lancuchowaniem (pojemnosc)
-                    OpenAddressingHashTable open_ht(size); // Inicjalizuj tabele z adresowaniem otwartym
-                    AVLHashTable avl_ht(size); // Inicjalizuj tabele z drzewami AVL
-
-                    // --- TESTY WSTAWIANIA ---
-                    auto start_time = std::chrono::high_resolution_clock::now(); // Czas rozpoczecia
-                    for (int key : current_keys) {
-                        chaining_ht.insert(key, 0); // Wartosc nie ma znaczenia dla pomiaru czasu
-                    }
-                    auto end_time = std::chrono::high_resolution_clock::now(); // Czas zakonczenia
-                    avg_chaining_insert += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / (double)size; // Dodaj czas do sumy
-
-                    start_time = std::chrono::high_resolution_clock::now();
-                    for (int key : current_keys) {
-                        open_ht.insert(key, 0);
-                    }
-                    end_time = std::chrono::high_resolution_clock::now();
-                    avg_open_insert += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / (double)size;
-
-                    start_time = std::chrono::high_resolution_clock::now();
-                    for (int key : current_keys) {
-                        avl_ht.insert(key, 0);
-                    }
-                    end_time = std::chrono::high_resolution_clock::now();
-                    avg_avl_insert += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / (double)size;
-
-
-                    // --- TESTY USUWANIA ---
-                    // Utworz kopie kluczy do usuniecia, aby nie zaklocac danych wstawiania
+                    // Klucze do usuniecia (polowa) w losowej kolejnosci, wspolne dla wszystkich silnikow
                     std::vector<int> keys_to_remove = current_keys;
-                    std::shuffle(keys_to_remove.begin(), keys_to_remove.end(), rep_gen); // Tasuj dla losowej kolejnosci usuwania
-
-                    start_time = std::chrono::high_resolution_clock::now();
-                    for (size_t i = 0; i < size / 2; ++i) { // Usun polowe elementow
-                        chaining_ht.remove(keys_to_remove[i]);
-                    }
-                    end_time = std::chrono::high_resolution_clock::now();
-                    avg_chaining_remove += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / (double)(size / 2);
-
-                    start_time = std::chrono::high_resolution_clock::now();
-                    for (size_t i = 0; i < size / 2; ++i) {
-                        open_ht.remove(keys_to_remove[i]);
-                    }
-                    end_time = std::chrono::high_resolution_clock::now();
-                    avg_open_remove += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / (double)(size / 2);
-
-                    start_time = std::chrono::high_resolution_clock::now();
-                    for (size_t i = 0; i < size / 2; ++i) {
-                        avl_ht.remove(keys_to_remove[i]);
+                    std::shuffle(keys_to_remove.begin(), keys_to_remove.end(), rep_gen);
+                    keys_to_remove.resize(size / 2);
+
+                    for (size_t m = 0; m < cache_modes.size(); ++m) {
+                        const bool cold = cache_modes[m] == CacheMode::COLD;
+                        for (size_t e = 0; e < engines.size(); ++e) {
+                            // Nowa instancja dla kazdego powtorzenia zapewnia czysty stan
+                            std::unique_ptr<HashTableBase> table = engines[e].make_for_keys(size);
+
+                            // Przygotowanie jednakowe w obu trybach: niemierzone wstawienie wszystkich
+                            // kluczy i clear() - pamiec tabeli jest juz zaalokowana, wiec roznica
+                            // zimny - cieply mierzy tylko obecnosc w cache, a nie alokacje i page faulty
+                            for (int key : current_keys) {
+                                table->insert(key, 0);
+                            }
+                            table->clear();
+                            if (cold) {
+                                evictor->evict(); // Tabela i klucze poza cache
+                            }
+
+                            // --- TEST WSTAWIANIA ---
+                            uint64_t start_time = timer.start(); // Czas rozpoczecia
+                            for (int key : current_keys) {
+                                table->insert(key, 0); // Wartosc nie ma znaczenia dla pomiaru czasu
+                            }
+                            uint64_t end_time = timer.stop(); // Czas zakonczenia
+                            insert_samples[m][e].push_back(timer.elapsed_ns(start_time, end_time) / size);
+                            avg_insert[m][e] += insert_samples[m][e].back();
+
+                            if (cold) {
+                                evictor->evict();
+                            }
+                            else {
+                                // Rozgrzewka: niemierzone wyszukanie usuwanych kluczy
+                                for (int key : keys_to_remove) {
+                                    table->contains(key);
+                                }
+                            }
+
+                            // --- TEST USUWANIA ---
+                            start_time = timer.start();
+                            for (int key : keys_to_remove) {
+                                table->remove(key);
+                            }
+                            end_time = timer.stop();
+                            remove_samples[m][e].push_back(timer.elapsed_ns(start_time, end_time) / keys_to_remove.size());
+                            avg_remove[m][e] += remove_samples[m][e].back();
+                        }
                     }
-                    end_time = std::chrono::high_resolution_clock::now();
-                    avg_avl_remove += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() / (double)(size / 2);
                 }
             }
 
             // Oblicz ogolne srednie
             double divisor = (double)num_data_sets * repetitions;
-            avg_open_insert /= divisor;
-            avg_chaining_insert /= divisor;
-            avg_avl_insert /= divisor;
-            avg_open_remove /= divisor;
-            avg_chaining_remove /= divisor;
-            avg_avl_remove /= divisor;
-            // Usunieto obliczenia dla srednich czasow wyszukiwania
+            for (size_t m = 0; m < cache_modes.size(); ++m) {
+                for (size_t e = 0; e < engines.size(); ++e) {
+                    avg_insert[m][e] /= divisor;
+                    avg_remove[m][e] /= divisor;
+                }
+            }
 
             // Zapisz wyniki do pliku
-            // Zaktualizowany zapis wynikow, bez kolumn wyszukiwania
-            outFile << size << "\t"
-                << avg_open_insert << "\t"
-                << avg_chaining_insert << "\t"
-                << avg_avl_insert << "\t"
-                << avg_open_remove << "\t"
-                << avg_chaining_remove << "\t"
-                << avg_avl_remove << "\n";
-
-            // Wyswietl wyniki w konsoli
-            std::cout << "  Results for size " << size << ":" << std::endl;
+            outFile << size;
+            for (size_t m = 0; m < cache_modes.size(); ++m) {
+                for (double ns : avg_insert[m]) outFile << "\t" << ns;
+                for (double ns : avg_remove[m]) outFile << "\t" << ns;
+            }
+            outFile << "\n";
+
+            // Wyswietl wyniki w konsoli (mediany) i zapisz statystyki komorek
+            std::cout << "  Results for size " << size << " (median ns/op, 95% CI):" << std::endl;
             std::cout << std::fixed << std::setprecision(2); // Formatuj wyjscie do 2 miejsc po przecinku
-            std::cout << "    Open Addressing Insert: " << avg_open_insert << " ns" << std::endl;
-            std::cout << "    Chaining Insert:        " << avg_chaining_insert << " ns" << std::endl;
-            std::cout << "    AVL Insert:             " << avg_avl_insert << " ns" << std::endl;
-            // Usunieto wyswietlanie wynikow wyszukiwania w konsoli
-            std::cout << "    Open Addressing Remove: " << avg_open_remove << " ns" << std::endl;
-            std::cout << "    Chaining Remove:        " << avg_chaining_remove << " ns" << std::endl;
-            std::cout << "    AVL Remove:             " << avg_avl_remove << " ns" << std::endl;
+            for (size_t m = 0; m < cache_modes.size(); ++m) {
+                std::cout << "   " << cache_mode_name(cache_modes[m]) << " cache:" << std::endl;
+                std::vector<SampleSummary> insert_stats;
+                std::vector<SampleSummary> remove_stats;
+                for (size_t e = 0; e < engines.size(); ++e) {
+                    insert_stats.push_back(summarize_samples(insert_samples[m][e]));
+                    remove_stats.push_back(summarize_samples(remove_samples[m][e]));
+                    write_stats_row(statsFile, size, cache_modes[m], engines[e], "insert", insert_stats.back());
+                    write_stats_row(statsFile, size, cache_modes[m], engines[e], "remove", remove_stats.back());
+                }
+                std::vector<double> baseline_insert;
+                std::vector<double> baseline_remove;
+                for (size_t index : baseline_indices) {
+                    baseline_insert.push_back(insert_stats[index].median);
+                    baseline_remove.push_back(remove_stats[index].median);
+                }
+                for (size_t e = 0; e < engines.size(); ++e) {
+                    print_with_speedup(engines[e].display_name + " Insert:", insert_stats[e], baselines, baseline_insert);
+                }
+                for (size_t e = 0; e < engines.size(); ++e) {
+                    print_with_speedup(engines[e].display_name + " Remove:", remove_stats[e], baselines, baseline_remove);
+                }
+            }
         }
 
         outFile.close(); // Zamknij plik
+        std::cout << "Per-cell statistics written to " << stats_filename << std::endl;
 
         auto full_time_end = std::chrono::high_resolution_clock::now(); // Czas zakonczenia calego testu
         auto full_time_duration = std::chrono::duration_cast<std::chrono::minutes>(full_time_end - full_time_start).count(); // Czas trwania w minutach
         std::cout << "\nTotal measurement time: " << full_time_duration << " minutes" << std::endl;
         std::cout << "=== PERFORMANCE TESTS COMPLETE ===" << std::endl;
     }
+
+    // Benchmark wyszukiwania z przewaga chybien: wszystkie szukane klucze sa spoza tabeli.
+    // Porownuje kazda zarejestrowana implementacje (poza punktami odniesienia) z ta sama
+    // implementacja poprzedzona filtrem Blooma.
+    void run_miss_benchmark(const std::vector<int>& sizes, int repetitions) {
+        std::cout << "\n=== STARTING MISS-HEAVY LOOKUP BENCHMARK ===" << std::endl;
+        std::cout << "SIMD kernels: " << cpu_kernels_description() << std::endl;
+        const PrecisionTimer& timer = precision_timer();
+        std::cout << "Timer: " << timer.description() << std::endl;
+        std::random_device rd;
+        std::mt19937 gen(rd());
+
+        for (int size : sizes) {
+            std::uniform_int_distribution<> dis_present(1, size * 10); // Klucze w tabeli
+            std::uniform_int_distribution<> dis_absent(size * 10 + 1, size * 20); // Klucze spoza tabeli
+
+            std::vector<int> keys(size);
+            std::vector<int> misses(size);
+            for (int i = 0; i < size; ++i) {
+                keys[i] = dis_present(gen);
+                misses[i] = dis_absent(gen);
+            }
+
+            std::vector<std::unique_ptr<HashTableBase>> tables;
+            for (const auto& engine : EngineRegistry::instance().engines()) {
+                if (engine.baseline) continue;
+                tables.push_back(engine.make_for_keys(size));
+                tables.push_back(std::make_unique<BloomFilteredHashTable>(engine.make_for_keys(size), size));
+            }
+
+            std::cout << "  Results for size " << size << " (ns per missed lookup):" << std::endl;
+            std::cout << std::fixed << std::setprecision(2);
+            for (auto& table : tables) {
+                for (int key : keys) {
+                    table->insert(key, 0);
+                }
+
+                double total_ns = 0;
+                size_t found = 0; // Licznik zapobiega wyeliminowaniu petli przez kompilator
+                for (int rep_idx = 0; rep_idx < repetitions; ++rep_idx) {
+                    uint64_t start_time = timer.start();
+                    for (int key : misses) {
+                        found += table->contains(key);
+                    }
+                    uint64_t end_time = timer.stop();
+                    total_ns += timer.elapsed_ns(start_time, end_time) / size;
+                }
+                std::cout << "    " << std::left << std::setw(45) << table->get_name() << std::right
+                          << total_ns / repetitions << " ns" << (found ? " (unexpected hits)" : "") << std::endl;
+            }
+        }
+        std::cout << "=== MISS-HEAVY LOOKUP BENCHMARK COMPLETE ===" << std::endl;
+    }
 };
 
 void demonstration() {
@@ -183,10 +324,11 @@ void demonstration() {
 
     // Testuj kazda implementacje
     // Inicjalizuj z rozsadna mala pojemnoscia dla demonstracji
+    // Wszystkie zarejestrowane silniki (engine_registry.h)
     std::vector<std::unique_ptr<HashTableBase>> tables;
-    tables.push_back(std::make_unique<ChainingHashTable>(8)); // Tabela z lancuchowaniem
-    tables.push_back(std::make_unique<OpenAddressingHashTable>(8)); // Tabela z adresowaniem otwartym
-    tables.push_back(std::make_unique<AVLHashTable>(8)); // Tabela z drzewami AVL
+    for (const auto& engine : EngineRegistry::instance().engines()) {
+        tables.push_back(engine.make_for_keys(8));
+    }
 
     for (auto& table : tables) { // Petla po kazdej tabeli hashujacej
         // Wyczysc poprzednie dane jesli istnieja (dla bezpieczenstwa, choc unique_ptr zapewnia swiezy start)
@@ -213,6 +355,13 @@ void demonstration() {
             }
         }
 
+        // Modyfikacja wartosci w miejscu (read-modify-write) jednym wyszukaniem
+        if (int* found = table->find_ptr(10)) {
+            *found += 1;
+            std::cout << "Key 10 incremented in place -> value " << *found << std::endl;
+        }
+        std::cout << "Contains key 99: " << (table->contains(99) ? "yes" : "no") << std::endl;
+
         // Test usuwania
         std::cout << "\nRemoving keys 22 and 31..." << std::endl;
         if (table->remove(22)) {
@@ -240,6 +389,344 @@ void demonstration() {
 
         table->clear(); // Wyczysc dla nastepnej tabeli
     }
+
+    // Statyczna tabela opcodow zbudowana w czasie kompilacji (hashowanie doskonale, bez sterty)
+    constexpr auto opcodes = FixedOpenAddressingHashTable<32>::build_perfect({
+        {0x01, 100}, {0x02, 200}, {0x10, 1600}, {0x20, 3200}, {0x7f, 12700}
+    });
+    static_assert(opcodes.is_perfect(), "Tabela opcodow powinna miec funkcje hashujaca doskonala");
+    static_assert(opcodes.contains(0x10) && !opcodes.contains(0x11), "Wyszukiwanie w czasie kompilacji");
+
+    std::cout << "\n--- Compile-time " << opcodes.size() << "-entry opcode table (capacity "
+              << opcodes.capacity() << ", perfect hash) ---" << std::endl;
+    int opcode_value;
+    for (int opcode : {0x01, 0x7f, 0x11}) {
+        if (opcodes.find(opcode, opcode_value)) {
+            std::cout << "Opcode " << opcode << " -> value " << opcode_value << std::endl;
+        }
+        else {
+            std::cout << "Opcode " << opcode << " not found" << std::endl;
+        }
+    }
+
+    // Statyczna tabela z minimalna funkcja hashujaca doskonala dla danych przykladowych
+    StaticPerfectHashTable static_table(sample_data);
+    std::cout << "\n--- " << static_table.get_name() << " built from " << static_table.size()
+              << " keys (" << static_table.bits_per_key() << " bits/key) ---" << std::endl;
+    int value;
+    for (int key : {10, 22, 99, 4}) {
+        if (static_table.find(key, value)) {
+            std::cout << "Key " << key << " -> value " << value << std::endl;
+        }
+        else {
+            std::cout << "Key " << key << " not found" << std::endl;
+        }
+    }
+}
+
+// Przeglad rozmiarow od 1K do 1G kluczy (co 4x) - od tabel w L1 do tabel w DRAM.
+// Rozmiary, ktore nie mieszcza sie w dostepnej pamieci, sa pomijane przez sterownik.
+void run_size_sweep() {
+    BenchmarkOptions options;
+    options.engines = { "open", "chaining", "avl", "std-unordered-map" };
+    options.operations = { "insert", "find", "miss" };
+    std::string error;
+    if (!BenchmarkDriver::apply_option(options, "sweep", "1k:1G:4", error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return;
+    }
+    options.repetitions = 3;
+
+    BenchmarkDriver driver;
+    std::vector<BenchmarkResult> results = driver.run(options);
+    BenchmarkDriver::write_results(std::cout, "table", results);
+    std::ofstream csv("size_sweep.csv");
+    BenchmarkDriver::write_results(csv, "csv", results);
+    std::cout << "Results also written to size_sweep.csv" << std::endl;
+}
+
+// Przeglad maksymalnych wspolczynnikow wypelnienia 0.3 - 0.95 dla 1M kluczy: przepustowosc
+// wzgledem pamieci na element (wykres w tabeli wynikow) dla silnikow z konfigurowalnym wspolczynnikiem.
+void run_load_factor_sweep() {
+    BenchmarkOptions options;
+    options.engines = { "open", "chaining", "avl", "std-unordered-map" };
+    options.operations = { "insert", "find", "miss" };
+    options.sizes = { 1000000 };
+    std::string error;
+    if (!BenchmarkDriver::apply_option(options, "load-factors", "0.3:0.95:0.05", error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return;
+    }
+    options.repetitions = 3;
+
+    BenchmarkDriver driver;
+    std::vector<BenchmarkResult> results = driver.run(options);
+    BenchmarkDriver::write_results(std::cout, "table", results);
+    std::ofstream csv("load_factor_sweep.csv");
+    BenchmarkDriver::write_results(csv, "csv", results);
+    std::cout << "Results also written to load_factor_sweep.csv" << std::endl;
+}
+
+// Obciazenia YCSB A-F dla wszystkich zarejestrowanych silnikow: 100k rekordow, rekordy
+// wybierane rownomiernie i wg rozkladu Zipfa; przepustowosc i percentyle opoznien.
+void run_ycsb_suite() {
+    BenchmarkOptions options;
+    options.engines = BenchmarkDriver::engine_names();
+    options.sizes = { 100000 };
+    options.distributions = { KeyDistribution::UNIFORM, KeyDistribution::ZIPF };
+    std::string error;
+    if (!BenchmarkDriver::apply_option(options, "ycsb", "all", error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return;
+    }
+    options.repetitions = 3;
+
+    BenchmarkDriver driver;
+    std::vector<YcsbResult> results = driver.run_ycsb(options);
+    BenchmarkDriver::write_ycsb_results(std::cout, "table", results);
+    std::ofstream csv("ycsb_results.csv");
+    BenchmarkDriver::write_ycsb_results(csv, "csv", results);
+    std::cout << "Results also written to ycsb_results.csv" << std::endl;
+}
+
+// Test soak: 1M kluczy, 20M wymian (losowo wybierany usuwany klucz), probka co 1M wymian -
+// czy przepustowosc, dlugosc probkowania i pamiec pozostaja stale w dlugim przebiegu.
+void run_soak_test() {
+    BenchmarkOptions options;
+    options.engines = { "open", "chaining", "avl", "std-unordered-map" };
+    options.sizes = { 1000000 };
+    options.soak_operations = 20000000;
+    options.soak_interval = 1000000;
+
+    BenchmarkDriver driver;
+    std::vector<SoakResult> results = driver.run_soak(options);
+    BenchmarkDriver::write_soak_results(std::cout, "table", results);
+    std::ofstream csv("soak_results.csv");
+    BenchmarkDriver::write_soak_results(csv, "csv", results);
+    std::cout << "Results also written to soak_results.csv" << std::endl;
+}
+
+// Nagrywa przykladowy zapis operacji (obciazenie YCSB A z rekordami wg rozkladu Zipfa:
+// 100k rekordow, 1M operacji) przez RecordingHashTable i odtwarza go na wszystkich silnikach.
+// Zapis z serwisu odtwarza sie tak samo: ./hash_tables --replay=plik.htr
+void run_trace_replay() {
+    const std::string path = "sample_trace.htr";
+    const uint64_t records = 100000;
+    const uint64_t operations = 1000000;
+    std::string error;
+    TraceWriter writer;
+    if (!writer.open(path, error)) {
+        std::cout << "Error: " << error << std::endl;
+        return;
+    }
+    {
+        RecordingHashTable table(BenchmarkDriver::make_engine("chaining", records), writer);
+        for (uint64_t record = 0; record < records; ++record) {
+            table.insert(ycsb_key(record), static_cast<int>(record));
+        }
+        YcsbOperationGenerator generator(YcsbWorkload::A, KeyDistribution::ZIPF, records, 0.99, 42);
+        long long sink = 0;
+        for (uint64_t i = 0; i < operations; ++i) {
+            sink += execute_ycsb_step(table, generator.next());
+        }
+        std::cout << "Recorded " << writer.record_count() << " operations to " << path << " (checksum " << sink
+                  << ")" << std::endl;
+    }
+    if (!writer.close(error)) {
+        std::cout << "Error: " << error << std::endl;
+        return;
+    }
+
+    BenchmarkOptions options;
+    options.engines = BenchmarkDriver::engine_names();
+    options.replay = path;
+    options.repetitions = 5;
+    BenchmarkDriver driver;
+    std::vector<TraceReplayResult> results;
+    if (!driver.run_replay(options, results, error)) {
+        std::cout << "Error: " << error << std::endl;
+        return;
+    }
+    BenchmarkDriver::write_replay_results(std::cout, "table", path, results);
+}
+
+// Sredni czas wyszukania kluczy z 'keys' (ns); 'sink' sumuje znalezione wartosci.
+static double time_avl_lookups(AVLHashTable& table, const std::vector<int>& keys, long long& sink) {
+    const PrecisionTimer& timer = precision_timer();
+    uint64_t start = timer.start();
+    for (int key : keys) {
+        const int* value = table.find_ptr(key);
+        sink += value ? *value : 0;
+    }
+    return timer.elapsed_ns(start, timer.stop()) / keys.size();
+}
+
+// Wyszukiwania w tabeli AVL przed i po freeze() (uklad Eytzingera) oraz czasy konwersji.
+// Wspolczynnik 1 daje male drzewa (1-2 elementy), 16 - drzewa o 4-5 poziomach, w ktorych
+// sledzenie wskaznikow kosztuje najwiecej.
+void run_freeze_benchmark() {
+    const uint64_t size = 1000000;
+    const PrecisionTimer& timer = precision_timer();
+    std::cout << "Timer: " << timer.description() << std::endl;
+    std::cout << "Threads for freeze/thaw: " << std::max(1u, std::thread::hardware_concurrency()) << std::endl;
+    SplitMix64 rng(42);
+    std::vector<int> hits(size);
+    std::vector<int> misses(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        hits[i] = key_at(rng.below(size), KeyDistribution::UNIFORM);
+        misses[i] = key_at(size + rng.below(size), KeyDistribution::UNIFORM);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (double load_factor : { 1.0, 16.0 }) {
+        AVLHashTable table(static_cast<size_t>(size / load_factor), load_factor);
+        for (uint64_t i = 0; i < size; ++i) {
+            int key = key_at(i, KeyDistribution::UNIFORM);
+            table.insert(key, key);
+        }
+        long long sink_tree = 0;
+        long long sink_frozen = 0;
+        double find_tree = time_avl_lookups(table, hits, sink_tree);
+        double miss_tree = time_avl_lookups(table, misses, sink_tree);
+        size_t tree_bytes = table.memory_usage();
+
+        uint64_t start = timer.start();
+        table.freeze();
+        double freeze_ms = timer.elapsed_ns(start, timer.stop()) / 1e6;
+        double find_frozen = time_avl_lookups(table, hits, sink_frozen);
+        double miss_frozen = time_avl_lookups(table, misses, sink_frozen);
+        size_t frozen_bytes = table.memory_usage();
+        ProbeStats probes;
+        table.probe_stats(probes);
+
+        start = timer.start();
+        table.thaw();
+        double thaw_ms = timer.elapsed_ns(start, timer.stop()) / 1e6;
+
+        std::cout << "Load factor " << load_factor << ", " << size << " keys:" << std::endl;
+        std::cout << "  tree:   find " << find_tree << " ns, miss " << miss_tree << " ns, "
+                  << tree_bytes / size << " B/entry" << std::endl;
+        std::cout << "  frozen: find " << find_frozen << " ns, miss " << miss_frozen << " ns, "
+                  << frozen_bytes / size << " B/entry, " << probes.average_hit << " comparisons/hit" << std::endl;
+        std::cout << "  freeze " << freeze_ms << " ms, thaw " << thaw_ms << " ms"
+                  << (sink_tree == sink_frozen ? "" : " (lookup results differ!)") << std::endl;
+    }
+}
+
+// Wyszukiwania przy skosnym (Zipf 0.99) i rownomiernym rozkladzie dostepow dla kubelkow
+// adaptacyjnych (move-to-front, transpozycja, splay) i pozostalych silnikow, przy
+// wspolczynnikach 1 i 8. Range Zipfa sa przypisane do kluczy losowa permutacja, wiec gorace
+// klucze nie sa tymi wstawionymi najwczesniej (ktore lancuch i tak ma na poczatku).
+// Przed pomiarem Zipfa jeden nie mierzony przebieg pozwala strukturom sie dostosowac.
+void run_skewed_lookup_benchmark() {
+    const uint64_t size = 1000000;
+    const std::vector<std::string> engines = { "chaining", "mtf-chaining", "transpose-chaining", "avl", "splay",
+                                               "btree", "std-unordered-map" };
+    const PrecisionTimer& timer = precision_timer();
+    std::cout << "Timer: " << timer.description() << std::endl;
+
+    std::vector<uint64_t> rank_to_index(size);
+    for (uint64_t i = 0; i < size; ++i) rank_to_index[i] = i;
+    std::shuffle(rank_to_index.begin(), rank_to_index.end(), std::mt19937_64(7));
+    SplitMix64 rng(42);
+    ZipfGenerator zipf(size, 0.99);
+    std::vector<int> uniform_keys(size);
+    std::vector<int> zipf_keys(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        uniform_keys[i] = key_at(rng.below(size), KeyDistribution::UNIFORM);
+        zipf_keys[i] = key_at(rank_to_index[zipf.next(rng)], KeyDistribution::UNIFORM);
+    }
+    auto time_lookups = [&](HashTableBase& table, const std::vector<int>& keys, long long& sink) {
+        uint64_t start = timer.start();
+        for (int key : keys) {
+            const int* value = table.find_ptr(key);
+            sink += value ? *value : 0;
+        }
+        return timer.elapsed_ns(start, timer.stop()) / keys.size();
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::left << std::setw(22) << "engine" << std::right << std::setw(6) << "lf" << std::setw(14)
+              << "uniform ns" << std::setw(12) << "zipf ns" << std::setw(10) << "speedup" << std::endl;
+    for (double load_factor : { 1.0, 8.0 }) {
+        for (const auto& engine : engines) {
+            std::unique_ptr<HashTableBase> table =
+                BenchmarkDriver::make_engine_for_load_factor(engine, static_cast<size_t>(size), load_factor);
+            if (!table->set_max_load_factor(load_factor)) {
+                if (load_factor != 1.0) continue; // Bez wspolczynnika - jeden wiersz wystarczy
+            }
+            for (uint64_t i = 0; i < size; ++i) {
+                int key = key_at(i, KeyDistribution::UNIFORM);
+                table->insert(key, key);
+            }
+            long long sink = 0;
+            double uniform_ns = time_lookups(*table, uniform_keys, sink);
+            time_lookups(*table, zipf_keys, sink); // Adaptacja do goracych kluczy
+            double zipf_ns = time_lookups(*table, zipf_keys, sink);
+            std::cout << std::left << std::setw(22) << engine << std::right << std::setw(6)
+                      << (table->get_max_load_factor() > 0 ? load_factor : 0.0) << std::setw(14) << uniform_ns
+                      << std::setw(12) << zipf_ns << std::setw(9) << uniform_ns / zipf_ns << "x"
+                      << (sink ? "" : " (no hits?)") << std::endl;
+        }
+    }
+}
+
+// Jeden przebieg mieszanki z przewaga usuniec dla tabeli drzewiastej z licznikiem rotacji:
+// zaladowanie 'size' kluczy, potem pary (usuniecie losowego obecnego klucza, wstawienie nowego) -
+// polowa operacji to usuniecia, a rozmiar tabeli pozostaje staly.
+template <class Table>
+void run_delete_mix(const char* name, double load_factor, uint64_t size, uint64_t pairs) {
+    const PrecisionTimer& timer = precision_timer();
+    Table table(static_cast<size_t>(size / load_factor), load_factor);
+    uint64_t start = timer.start();
+    for (uint64_t i = 0; i < size; ++i) {
+        int key = key_at(i, KeyDistribution::UNIFORM);
+        table.insert(key, key);
+    }
+    double load_ns = timer.elapsed_ns(start, timer.stop());
+    uint64_t load_rotations = table.rotation_count();
+
+    SplitMix64 rng(42);
+    std::vector<uint32_t> live(size);
+    for (uint64_t i = 0; i < size; ++i) live[i] = static_cast<uint32_t>(i);
+    std::vector<int> removed(pairs);
+    std::vector<int> inserted(pairs);
+    uint64_t next_index = size;
+    for (uint64_t i = 0; i < pairs; ++i) {
+        uint64_t victim = rng.below(size);
+        removed[i] = key_at(live[victim], KeyDistribution::UNIFORM);
+        inserted[i] = key_at(next_index, KeyDistribution::UNIFORM);
+        live[victim] = static_cast<uint32_t>(next_index++);
+    }
+    size_t failed = 0;
+    start = timer.start();
+    for (uint64_t i = 0; i < pairs; ++i) {
+        failed += !table.remove(removed[i]);
+        table.insert(inserted[i], inserted[i]);
+    }
+    double mix_ns = timer.elapsed_ns(start, timer.stop());
+    double mix_rotations = static_cast<double>(table.rotation_count() - load_rotations);
+
+    std::cout << std::left << std::setw(6) << name << std::right << std::setw(6) << load_factor << std::setw(14)
+              << static_cast<double>(load_rotations) / size << std::setw(12) << size / load_ns * 1e3 << std::setw(14)
+              << mix_rotations / (2 * pairs) << std::setw(12) << 2 * pairs / mix_ns * 1e3
+              << (failed ? " (missed removes!)" : "") << std::endl;
+}
+
+// AVL i WAVL przy mieszance 50% usuniec / 50% wstawien (1M kluczy, 4M operacji): rotacje na
+// operacje i przepustowosc przy wspolczynniku 1 (drzewa 1-3 wezly) i 16 (drzewa ~5 poziomow).
+void run_delete_mix_benchmark() {
+    const uint64_t size = 1000000;
+    const uint64_t pairs = 2000000;
+    std::cout << "Timer: " << precision_timer().description() << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(6) << "tree" << std::right << std::setw(6) << "lf" << std::setw(14)
+              << "load rot/ins" << std::setw(12) << "load Mops" << std::setw(14) << "mix rot/op" << std::setw(12)
+              << "mix Mops" << std::endl;
+    for (double load_factor : { 1.0, 16.0 }) {
+        run_delete_mix<AVLHashTable>("AVL", load_factor, size, pairs);
+        run_delete_mix<WAVLHashTable>("WAVL", load_factor, size, pairs);
+    }
 }
 
 // Glowne menu do interakcji z uzytkownikiem
@@ -256,6 +743,15 @@ void mainMenu() {
         std::cout << "\n=== MAIN MENU ===" << std::endl;
         std::cout << "1. Run Performance Benchmarks (Insert and Remove)" << std::endl; // Zaktualizowany opis
         std::cout << "2. Show Demonstration of Hash Table Operations" << std::endl;
+        std::cout << "3. Run Miss-Heavy Lookup Benchmark (Bloom filter front-end)" << std::endl;
+        std::cout << "4. Run Large-Scale Size Sweep (1K - 1G keys, L1/L2/L3/DRAM)" << std::endl;
+        std::cout << "5. Run Load Factor Sweep (0.3 - 0.95, throughput vs bytes/entry)" << std::endl;
+        std::cout << "6. Run YCSB Workloads A-F (throughput and latency percentiles)" << std::endl;
+        std::cout << "7. Run Soak Test (20M key replacements, degradation over time)" << std::endl;
+        std::cout << "8. Record a Sample Trace and Replay It on All Engines" << std::endl;
+        std::cout << "9. Run AVL Freeze Benchmark (Eytzinger layout vs tree lookups)" << std::endl;
+        std::cout << "10. Run Skewed Lookup Benchmark (Zipf, self-adjusting buckets)" << std::endl;
+        std::cout << "11. Run Delete-Heavy Mix Benchmark (AVL vs WAVL rotations)" << std::endl;
         std::cout << "0. Exit" << std::endl;
         std::cout << "Choose an option: ";
         std::cin >> choice;
@@ -269,6 +765,35 @@ void mainMenu() {
         case 2:
             demonstration(); // Wywolaj demonstracje
             break;
+        case 3: {
+            PerformanceTester tester;
+            tester.run_miss_benchmark(test_sizes, repetitions_per_data_set);
+            break;
+        }
+        case 4:
+            run_size_sweep();
+            break;
+        case 5:
+            run_load_factor_sweep();
+            break;
+        case 6:
+            run_ycsb_suite();
+            break;
+        case 7:
+            run_soak_test();
+            break;
+        case 8:
+            run_trace_replay();
+            break;
+        case 9:
+            run_freeze_benchmark();
+            break;
+        case 10:
+            run_skewed_lookup_benchmark();
+            break;
+        case 11:
+            run_delete_mix_benchmark();
+            break;
         case 0:
             exit_program = true; // Ustaw flage wyjscia
             break;
@@ -282,7 +807,13 @@ void mainMenu() {
     }
 }
 
-int main() {
+// Bez argumentow program dziala interaktywnie (menu); z argumentami uruchamia
+// sterownik benchmarkow (--help wypisuje dostepne opcje).
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        return run_benchmark_cli(argc, argv);
+    }
+
     std::cout << "PROJECT: DICTIONARY IMPLEMENTATIONS BASED ON HASH TABLES" << std::endl;
     std::cout << "Implementations: Chaining, Open Addressing, Chaining with AVL Trees" << std::endl;
     std::cout << std::string(70, '=') << std::endl;
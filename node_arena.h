@@ -0,0 +1,101 @@
+#ifndef NODE_ARENA_H
+#define NODE_ARENA_H
+
+#include <algorithm>   // std::min
+#include <cstddef>     // size_t
+#include <memory>      // std::unique_ptr dla blokow pamieci
+#include <new>         // placement new
+#include <type_traits> // std::is_trivially_destructible
+#include <utility>     // std::forward
+#include <vector>      // Lista blokow
+
+// Arena (pula) wezlow drzew uzywana przez tabele z kubelkami drzewiastymi.
+// Wezly sa wycinane z coraz wiekszych blokow zamiast alokowane pojedynczo przez new,
+// usuniete wezly trafiaja na liste wolnych i sa uzywane ponownie.
+// reset() zwalnia wszystkie wezly naraz w czasie O(1) - bloki zostaja do ponownego uzycia,
+// dlatego typ wezla musi byc trywialnie destruowalny (nie trzeba wolac destruktorow).
+template <class Node>
+class NodeArena {
+    static_assert(std::is_trivially_destructible<Node>::value,
+                  "NodeArena wymaga trywialnie destruowalnych wezlow");
+
+private:
+    // Slot bloku: albo wezel, albo wskaznik na nastepny wolny slot.
+    union Slot {
+        Slot* next_free;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    static constexpr size_t FIRST_BLOCK_NODES = 64;    // Rozmiar pierwszego bloku
+    static constexpr size_t MAX_BLOCK_NODES = 65536;   // Gorny limit rozmiaru bloku
+
+    std::vector<std::unique_ptr<Slot[]>> blocks; // Zaalokowane bloki
+    std::vector<size_t> block_sizes;             // Liczba slotow w kazdym bloku
+    size_t current_block = 0;  // Blok, z ktorego wycinane sa nowe wezly
+    size_t used_in_block = 0;  // Liczba wycietych slotow w biezacym bloku
+    Slot* free_list = nullptr; // Lista slotow zwolnionych przez destroy()
+
+    // Zwraca nieuzywany slot, w razie potrzeby przechodzac do kolejnego (lub nowego) bloku.
+    Slot* take_slot() {
+        if (free_list) {
+            Slot* slot = free_list;
+            free_list = slot->next_free;
+            return slot;
+        }
+        while (current_block < blocks.size() && used_in_block == block_sizes[current_block]) {
+            current_block++;
+            used_in_block = 0;
+        }
+        if (current_block == blocks.size()) {
+            size_t nodes = blocks.empty() ? FIRST_BLOCK_NODES
+                                          : std::min(block_sizes.back() * 2, MAX_BLOCK_NODES);
+            blocks.emplace_back(new Slot[nodes]);
+            block_sizes.push_back(nodes);
+            used_in_block = 0;
+        }
+        return &blocks[current_block][used_in_block++];
+    }
+
+public:
+    NodeArena() = default;
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    // Tworzy wezel w arenie (odpowiednik new Node(args...)).
+    template <class... Args>
+    Node* create(Args&&... args) {
+        return new (take_slot()->storage) Node(std::forward<Args>(args)...);
+    }
+
+    // Zwraca pojedynczy wezel do areny (odpowiednik delete).
+    void destroy(Node* node) {
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next_free = free_list;
+        free_list = slot;
+    }
+
+    // Zwalnia wszystkie wezly naraz w czasie O(1); pamiec blokow zostaje do ponownego uzycia.
+    void reset() {
+        current_block = 0;
+        used_in_block = 0;
+        free_list = nullptr;
+    }
+
+    // Zwalnia wszystkie wezly i oddaje pamiec blokow systemowi.
+    void release() {
+        blocks.clear();
+        block_sizes.clear();
+        reset();
+    }
+
+    // Liczba bajtow zarezerwowanych przez arene.
+    size_t capacity_bytes() const {
+        size_t total = 0;
+        for (size_t nodes : block_sizes) {
+            total += nodes * sizeof(Slot);
+        }
+        return total;
+    }
+};
+
+#endif // NODE_ARENA_H
@@ -1,172 +1,357 @@
-#ifndef OPEN_ADDRESSING_HASH_TABLE_H
-#define OPEN_ADDRESSING_HASH_TABLE_H
-
-#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
-
-
-class OpenAddressingHashTable : public HashTableBase {
-private:
-    // Enumerator do oznaczania stanu miejsca w tabeli:
-    // EMPTY: puste miejsce, nigdy nie bylo uzywane lub zostalo wyczyszczone.
-    // OCCUPIED: miejsce zajete przez wazny element.
-    // DELETED: miejsce zajete przez element, ktory zostal usuniety.
-    //          Wazne dla probkowania liniowego, aby kontynuowac wyszukiwanie.
-    enum class EntryState { EMPTY, OCCUPIED, DELETED };
-
-    // Struktura reprezentujaca pojedynczy wpis w tabeli hashujacej.
-    struct Entry {
-        int key; // Klucz elementu
-        int value; // Wartosc elementu
-        EntryState state; // Stan tego wpisu
-
-        Entry() : key(0), value(0), state(EntryState::EMPTY) {} // Konstruktor domyslny
-        Entry(int k, int v) : key(k), value(v), state(EntryState::OCCUPIED) {} // Konstruktor z kluczem i wartoscia
-    };
-
-    std::vector<Entry> table; // Glowna tabela przechowujaca wpisy
-    size_t table_size; // Aktualny rozmiar (pojemnosc) tabeli
-    size_t current_size; // Liczba aktualnie przechowywanych elementow (nie wlaczajac DELETED)
-
-    // Maksymalny wspolczynnik wypelnienia, po przekroczeniu ktorego tabela zostanie powiekszona.
-    // Zazwyczaj niski dla adresowania otwartego, aby uniknac klastrowania.
-    static constexpr double MAX_LOAD_FACTOR = 0.5;
-
-    // Metoda do zmiany rozmiaru tabeli (podwajania jej pojemnosci).
-    void resize() {
-        size_t old_size = table_size; // Zapisz stary rozmiar
-        auto old_table = std::move(table); // Przenies stara tabele (optymalizacja)
-
-        table_size *= 2; // Podwoj rozmiar tabeli
-        table.clear(); // Wyczysc biezaca (nowa) tabele
-        table.resize(table_size); // Zmien rozmiar nowej tabeli
-        current_size = 0; // Zresetuj licznik elementow
-
-        // Przepisz wszystkie elementy ze starej tabeli do nowej.
-        // Nalezy je ponownie wstawic, aby obliczyc nowe pozycje hash.
-        for (const auto& entry : old_table) {
-            if (entry.state == EntryState::OCCUPIED) {
-                insert(entry.key, entry.value); // Uzyj metody insert do ponownego wstawienia
-            }
-        }
-    }
-
-    // Metoda probkujaca (probing) do znalezienia odpowiedniego indeksu dla klucza.
-    // Uzywa probkowania liniowego.
-    size_t probe(int key) const {
-        size_t index = hash_function(key, table_size); // Oblicz poczatkowy indeks za pomoca funkcji hashujacej
-        size_t original_index = index; // Zapisz poczatkowy indeks do wykrywania pelnej tabeli
-
-        // Szukaj wolnego miejsca lub klucza:
-        // Kontynuuj, dopoki nie znajdziesz pustego miejsca (EMPTY)
-        // LUB (jesli miejsce nie jest puste):
-        //    stan to DELETED (kontynuuj szukanie)
-        //    LUB klucz w miejscu nie odpowiada szukanemu kluczowi
-        while (table[index].state != EntryState::EMPTY &&
-            (table[index].state == EntryState::DELETED || table[index].key != key)) {
-            index = (index + 1) % table_size; // Przejdz do nastepnego miejsca (probkowanie liniowe)
-            if (index == original_index) break; // Jesli wrocilismy do punktu poczatkowego, tabela jest pelna
-        }
-
-        return index; // Zwroc znaleziony indeks
-    }
-
-public:
-    // Konstruktor, inicjalizuje tabele z podanym rozmiarem poczatkowym.
-    explicit OpenAddressingHashTable(size_t initial_size = 16)
-        : table_size(initial_size), current_size(0) {
-        table.resize(table_size); // Zmien rozmiar wektora na poczatkowa pojemnosc
-    }
-
-    // Wstawia pare klucz-wartosc do tabeli.
-    // Zwraca true, jesli wstawienie/aktualizacja sie powiodla, false w przeciwnym razie.
-    bool insert(int key, int value) override {
-        // Sprawdz wspolczynnik wypelnienia, jesli przekroczony, zmien rozmiar tabeli.
-        if (static_cast<double>(current_size) / table_size > MAX_LOAD_FACTOR) {
-            resize();
-        }
-
-        size_t index = probe(key); // Znajdz odpowiedni indeks dla klucza
-
-        // Jesli znaleziono zajete miejsce z tym samym kluczem, zaktualizuj wartosc.
-        if (table[index].state == EntryState::OCCUPIED && table[index].key == key) {
-            table[index].value = value; // Aktualizuj wartosc
-            return true;
-        }
-
-        // Jesli miejsce jest puste lub oznaczone jako usuniete, wstaw nowy element.
-        if (table[index].state != EntryState::OCCUPIED) {
-            table[index] = Entry(key, value); // Utworz nowy wpis
-            current_size++; // Zwieksz licznik elementow
-            return true;
-        }
-
-        return false; // Tabela jest pelna (nie mozna wstawic, mimo probkowania)
-    }
-
-    // Usuwa element z podanym kluczem z tabeli.
-    // Zwraca true, jesli element zostal usuniety, false w przeciwnym razie.
-    bool remove(int key) override {
-        size_t index = probe(key); // Znajdz indeks klucza
-
-        // Jesli znaleziono zajete miejsce z tym samym kluczem, oznacz jako usuniety.
-        if (table[index].state == EntryState::OCCUPIED && table[index].key == key) {
-            table[index].state = EntryState::DELETED; // Oznacz jako usuniety (tzw. lazy deletion)
-            current_size--; // Zmniejsz licznik elementow
-            return true;
-        }
-
-        return false; // Element nie znaleziony
-    }
-
-    // Znajduje wartosc skojarzona z podanym kluczem.
-    // Zwraca true, jesli klucz zostal znaleziony, a wartosc jest przypisana do 'value', false w przeciwnym razie.
-    bool find(int key, int& value) override {
-        size_t index = probe(key); // Znajdz indeks klucza
-
-        // Jesli znaleziono zajete miejsce z tym samym kluczem, przypisz wartosc.
-        if (table[index].state == EntryState::OCCUPIED && table[index].key == key) {
-            value = table[index].value; // Przypisz znaleziona wartosc
-            return true;
-        }
-
-        return false; // Klucz nie znaleziony
-    }
-
-    // Wyswietla zawartosc tabeli hashujacej.
-    void display() override {
-        std::cout << "=== Open Addressing Hash Table ===" << std::endl;
-        for (size_t i = 0; i < table_size; ++i) {
-            std::cout << "Index " << i << ": ";
-            if (table[i].state == EntryState::OCCUPIED) {
-                std::cout << "(" << table[i].key << "," << table[i].value << ")";
-            }
-            else if (table[i].state == EntryState::DELETED) {
-                std::cout << "[DELETED]";
-            }
-            else {
-                std::cout << "[EMPTY]";
-            }
-            std::cout << std::endl;
-        }
-        std::cout << "Size: " << current_size << "/" << table_size << std::endl;
-    }
-
-    // Zwraca aktualna liczbe elementow w tabeli.
-    size_t size() const override { return current_size; }
-
-    // Czyści tabele, ustawiajac wszystkie wpisy na EMPTY.
-    void clear() override {
-        for (auto& entry : table) {
-            entry.state = EntryState::EMPTY; // Ustaw stan na pusty
-        }
-        current_size = 0; // Zresetuj licznik elementow
-    }
-
-    // Zwraca nazwe implementacji tabeli hashujacej.
-    // Uwaga: Tutaj powinno byc "Open Addressing Hash Table", a nie "AVL Hash Table".
-    std::string get_name() const override {
-        return "Open Addressing Hash Table";
-    }
-};
-
-#endif // OPEN_ADDRESSING_HASH_TABLE_H
+#ifndef OPEN_ADDRESSING_HASH_TABLE_H
+#define OPEN_ADDRESSING_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "engine_registry.h" // Rejestracja w benchmarkach i demonstracji
+#include <algorithm> // std::max
+#include <cmath> // std::ceil - nowy rozmiar przy wzroscie
+#include <cstdint> // uint8_t / uint16_t dla kompaktowego stanu wpisu
+
+
+class OpenAddressingHashTable : public HashTableBase {
+private:
+    // Enumerator do oznaczania stanu miejsca w tabeli:
+    // EMPTY: puste miejsce, nigdy nie bylo uzywane lub zostalo wyczyszczone.
+    // OCCUPIED: miejsce zajete przez wazny element.
+    // DELETED: miejsce zajete przez element, ktory zostal usuniety.
+    //          Wazne dla probkowania liniowego, aby kontynuowac wyszukiwanie.
+    enum class EntryState : uint8_t { EMPTY, OCCUPIED, DELETED };
+
+    // Struktura reprezentujaca pojedynczy wpis w tabeli hashujacej.
+    // Stan i generacja mieszcza sie w 4 bajtach, wiec wpis nadal zajmuje 12 bajtow.
+    struct Entry {
+        int key; // Klucz elementu
+        int value; // Wartosc elementu
+        EntryState state; // Stan tego wpisu (wazny tylko w generacji 'generation')
+        uint16_t generation; // Generacja tabeli, w ktorej wpis zostal zapisany
+
+        Entry() : key(0), value(0), state(EntryState::EMPTY), generation(0) {} // Konstruktor domyslny
+        Entry(int k, int v, uint16_t gen) : key(k), value(v), state(EntryState::OCCUPIED), generation(gen) {} // Konstruktor z kluczem i wartoscia
+    };
+
+    std::vector<Entry> table; // Glowna tabela przechowujaca wpisy
+    size_t table_size; // Aktualny rozmiar (pojemnosc) tabeli
+    size_t current_size; // Liczba aktualnie przechowywanych elementow (nie wlaczajac DELETED)
+    size_t tombstones; // Liczba slotow DELETED w biezacej generacji
+    uint16_t generation; // Biezaca generacja; wpisy z innej generacji sa traktowane jako EMPTY
+    double max_load_factor; // Wspolczynnik wypelnienia, po przekroczeniu ktorego tabela rosnie
+    double growth_factor; // Krotnosc wzrostu tabeli przy resize()
+
+    // Stan wpisu w biezacej generacji. Dzieki temu clear() tylko zwieksza licznik generacji
+    // (O(1)) zamiast nadpisywac kazdy slot - nieaktualne wpisy czytaja sie jako puste.
+    EntryState state_of(const Entry& entry) const {
+        return entry.generation == generation ? entry.state : EntryState::EMPTY;
+    }
+
+    // Domyslny maksymalny wspolczynnik wypelnienia, po przekroczeniu ktorego tabela zostanie powiekszona.
+    // Zazwyczaj niski dla adresowania otwartego, aby uniknac klastrowania.
+    static constexpr double DEFAULT_MAX_LOAD_FACTOR = 0.5;
+    // Gorna granica wspolczynnika - blisko 1 probkowanie liniowe przeglada prawie cala tabele.
+    static constexpr double LOAD_FACTOR_LIMIT = 0.99;
+    static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
+    static constexpr double GROWTH_FACTOR_LIMIT = 4.0;
+
+    // Sloty DELETED wydluzaja probkowanie tak samo jak zajete, wiec licza sie do wypelnienia.
+    // Bez tego ciagle usuwanie i wstawianie przy stalej liczbie elementow zapelnialo tabele
+    // slotami DELETED (nie bylo resize) i kazde chybienie przegladalo cala tabele.
+    bool over_load_factor() const {
+        return static_cast<double>(current_size + tombstones) / table_size > max_load_factor;
+    }
+
+    // Nowy rozmiar przy wzroscie: 'growth_factor' razy wiekszy, co najmniej o 1.
+    size_t grown_size() const {
+        size_t grown = static_cast<size_t>(std::ceil(table_size * growth_factor));
+        return grown > table_size ? grown : table_size + 1;
+    }
+
+    // Wywolywane po przekroczeniu wspolczynnika wypelnienia. Jesli same elementy zajmuja wiecej
+    // niz polowe limitu, tabela rosnie; w przeciwnym razie wypelnienie to glownie sloty DELETED
+    // i wystarczy przebudowa w tym samym rozmiarze (po niej co najmniej polowa limitu jest wolna,
+    // wiec koszt przebudowy rozklada sie na wiele usuniec).
+    void make_room() {
+        bool grow = static_cast<double>(current_size) / table_size > max_load_factor / 2;
+        resize(grow ? grown_size() : table_size);
+    }
+
+    // Alokuje sloty przy pierwszym wstawieniu (pusta tabela nie zajmuje pamieci).
+    void ensure_allocated() {
+        if (table.empty()) {
+            if (table_size == 0) table_size = 1;
+            table.resize(table_size);
+        }
+    }
+
+    // Metoda do zmiany rozmiaru tabeli na 'new_size' slotow (przebudowa usuwa tez sloty DELETED).
+    void resize(size_t new_size) {
+        auto old_table = std::move(table); // Przenies stara tabele (optymalizacja)
+
+        table_size = new_size; // Ustaw nowy rozmiar tabeli
+        table.clear(); // Wyczysc biezaca (nowa) tabele
+        table.resize(table_size); // Zmien rozmiar nowej tabeli
+        current_size = 0; // Zresetuj licznik elementow
+        tombstones = 0;
+
+        // Przepisz wszystkie elementy ze starej tabeli do nowej.
+        // Nalezy je ponownie wstawic, aby obliczyc nowe pozycje hash.
+        for (const auto& entry : old_table) {
+            if (state_of(entry) == EntryState::OCCUPIED) {
+                insert(entry.key, entry.value); // Uzyj metody insert do ponownego wstawienia
+            }
+        }
+    }
+
+    // Metoda probkujaca (probing) do znalezienia odpowiedniego indeksu dla klucza.
+    // Uzywa probkowania liniowego.
+    size_t probe(int key) const {
+        size_t index = hash_function(key, table_size); // Oblicz poczatkowy indeks za pomoca funkcji hashujacej
+        size_t original_index = index; // Zapisz poczatkowy indeks do wykrywania pelnej tabeli
+
+        // Szukaj wolnego miejsca lub klucza:
+        // Kontynuuj, dopoki nie znajdziesz pustego miejsca (EMPTY)
+        // LUB (jesli miejsce nie jest puste):
+        //    stan to DELETED (kontynuuj szukanie)
+        //    LUB klucz w miejscu nie odpowiada szukanemu kluczowi
+        while (state_of(table[index]) != EntryState::EMPTY &&
+            (state_of(table[index]) == EntryState::DELETED || table[index].key != key)) {
+            index = (index + 1) % table_size; // Przejdz do nastepnego miejsca (probkowanie liniowe)
+            if (index == original_index) break; // Jesli wrocilismy do punktu poczatkowego, tabela jest pelna
+        }
+
+        return index; // Zwroc znaleziony indeks
+    }
+
+public:
+    // Konstruktor, zapamietuje rozmiar poczatkowy. Sloty sa alokowane leniwie - przy pierwszym insert.
+    // Wspolczynnik wypelnienia i krotnosc wzrostu spoza dozwolonego zakresu sa ignorowane
+    // (zostaja wartosci domyslne) - patrz set_max_load_factor / set_growth_factor.
+    explicit OpenAddressingHashTable(size_t initial_size = 16, double max_load_factor = DEFAULT_MAX_LOAD_FACTOR,
+                                     double growth_factor = DEFAULT_GROWTH_FACTOR)
+        : table_size(initial_size), current_size(0), tombstones(0), generation(1),
+          max_load_factor(DEFAULT_MAX_LOAD_FACTOR), growth_factor(DEFAULT_GROWTH_FACTOR) {
+        set_max_load_factor(max_load_factor);
+        set_growth_factor(growth_factor);
+    }
+
+    // Wstawia pare klucz-wartosc do tabeli.
+    // Zwraca true, jesli wstawienie/aktualizacja sie powiodla, false w przeciwnym razie.
+    bool insert(int key, int value) override {
+        ensure_allocated();
+
+        // Sprawdz wspolczynnik wypelnienia, jesli przekroczony, zmien rozmiar tabeli.
+        if (over_load_factor()) {
+            make_room();
+        }
+
+        // Szukaj klucza az do pustego miejsca, zapamietujac pierwszy slot DELETED na sciezce -
+        // nowy klucz trafia tam zamiast do pustego slotu dalej (krotsza sciezka, mniej slotow DELETED).
+        size_t index = hash_function(key, table_size);
+        size_t reusable = table_size; // Pierwszy slot DELETED; table_size - brak
+        for (size_t step = 0; step < table_size; ++step) {
+            EntryState state = state_of(table[index]);
+            if (state == EntryState::EMPTY) break;
+            if (state == EntryState::DELETED) {
+                if (reusable == table_size) reusable = index;
+            }
+            else if (table[index].key == key) {
+                table[index].value = value; // Klucz istnieje - aktualizuj wartosc
+                return true;
+            }
+            index = (index + 1) % table_size; // Przejdz do nastepnego miejsca (probkowanie liniowe)
+        }
+
+        // Wstaw nowy element do slotu DELETED z sciezki albo do znalezionego pustego miejsca.
+        if (reusable != table_size) {
+            table[reusable] = Entry(key, value, generation);
+            tombstones--;
+            current_size++;
+            return true;
+        }
+        if (state_of(table[index]) == EntryState::EMPTY) {
+            table[index] = Entry(key, value, generation); // Utworz nowy wpis
+            current_size++; // Zwieksz licznik elementow
+            return true;
+        }
+
+        return false; // Tabela jest pelna (nie mozna wstawic, mimo probkowania)
+    }
+
+    // Usuwa element z podanym kluczem z tabeli.
+    // Zwraca true, jesli element zostal usuniety, false w przeciwnym razie.
+    bool remove(int key) override {
+        if (table.empty()) return false; // Tabela jeszcze niezaalokowana
+
+        size_t index = probe(key); // Znajdz indeks klucza
+
+        // Jesli znaleziono zajete miejsce z tym samym kluczem, oznacz jako usuniety.
+        if (state_of(table[index]) == EntryState::OCCUPIED && table[index].key == key) {
+            table[index].state = EntryState::DELETED; // Oznacz jako usuniety (tzw. lazy deletion)
+            current_size--; // Zmniejsz licznik elementow
+            tombstones++;
+            return true;
+        }
+
+        return false; // Element nie znaleziony
+    }
+
+    // Znajduje wartosc skojarzona z podanym kluczem.
+    // Zwraca true, jesli klucz zostal znaleziony, a wartosc jest przypisana do 'value', false w przeciwnym razie.
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found; // Przypisz znaleziona wartosc
+            return true;
+        }
+
+        return false; // Klucz nie znaleziony
+    }
+
+    // Zwraca wskaznik do wartosci w slocie tabeli lub nullptr.
+    // Sloty NIE sa stabilne: wskaznik traci waznosc przy kazdym insert (resize
+    // przenosi wszystkie wpisy), remove tego klucza oraz clear.
+    const int* find_ptr(int key) const override {
+        if (table.empty()) return nullptr; // Tabela jeszcze niezaalokowana
+
+        size_t index = probe(key); // Znajdz indeks klucza
+
+        // Jesli znaleziono zajete miejsce z tym samym kluczem, zwroc adres wartosci.
+        if (state_of(table[index]) == EntryState::OCCUPIED && table[index].key == key) {
+            return &table[index].value;
+        }
+
+        return nullptr; // Klucz nie znaleziony
+    }
+
+    int* find_ptr(int key) override {
+        return const_cast<int*>(static_cast<const OpenAddressingHashTable*>(this)->find_ptr(key));
+    }
+
+    // Wywoluje 'visit' dla kazdego zajetego slotu.
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const auto& entry : table) {
+            if (state_of(entry) == EntryState::OCCUPIED) {
+                visit(entry.key, entry.value);
+            }
+        }
+    }
+
+    // Wyswietla zawartosc tabeli hashujacej.
+    void display() override {
+        std::cout << "=== Open Addressing Hash Table ===" << std::endl;
+        for (size_t i = 0; i < table.size(); ++i) {
+            std::cout << "Index " << i << ": ";
+            if (state_of(table[i]) == EntryState::OCCUPIED) {
+                std::cout << "(" << table[i].key << "," << table[i].value << ")";
+            }
+            else if (state_of(table[i]) == EntryState::DELETED) {
+                std::cout << "[DELETED]";
+            }
+            else {
+                std::cout << "[EMPTY]";
+            }
+            std::cout << std::endl;
+        }
+        std::cout << "Size: " << current_size << "/" << table_size << ", deleted: " << tombstones << std::endl;
+    }
+
+    // Zwraca aktualna liczbe elementow w tabeli.
+    size_t size() const override { return current_size; }
+
+    // Obiekt i sloty (takze puste i usuniete).
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(table.capacity() * sizeof(Entry));
+    }
+
+    // Trafienie: odleglosc slotu od pozycji poczatkowej + 1. Chybienie: sloty od pozycji poczatkowej
+    // do pierwszego pustego wlacznie - dla ciagu c niepustych slotow to c(c+1)/2 + c w sumie.
+    bool probe_stats(ProbeStats& stats) const override {
+        stats = ProbeStats();
+        stats.tombstones = tombstones;
+        if (table.empty()) return true;
+
+        double hit_total = 0;
+        for (size_t i = 0; i < table_size; ++i) {
+            if (state_of(table[i]) != EntryState::OCCUPIED) continue;
+            size_t home = hash_function(table[i].key, table_size);
+            size_t distance = (i + table_size - home) % table_size + 1;
+            hit_total += static_cast<double>(distance);
+            stats.max_hit = std::max(stats.max_hit, distance);
+        }
+        stats.average_hit = current_size ? hit_total / static_cast<double>(current_size) : 0.0;
+
+        // Ciagi niepustych slotow liczone od pustego slotu, aby ciag na granicy tabeli nie byl podzielony
+        size_t start = 0;
+        while (start < table_size && state_of(table[start]) != EntryState::EMPTY) ++start;
+        if (start == table_size) {
+            stats.average_miss = static_cast<double>(table_size); // Brak pustego slotu - chybienie obchodzi cala tabele
+            return true;
+        }
+        double miss_total = 0;
+        double run = 0;
+        for (size_t step = 1; step <= table_size; ++step) {
+            if (state_of(table[(start + step) % table_size]) == EntryState::EMPTY) {
+                miss_total += run * (run + 1) / 2 + run + 1; // Ciag i pusty slot konczacy go
+                run = 0;
+            }
+            else {
+                run += 1;
+            }
+        }
+        stats.average_miss = miss_total / static_cast<double>(table_size);
+        return true;
+    }
+
+    // Dozwolony zakres: (0, LOAD_FACTOR_LIMIT].
+    bool set_max_load_factor(double value) override {
+        if (!(value > 0.0 && value <= LOAD_FACTOR_LIMIT)) return false;
+        max_load_factor = value;
+        while (!table.empty() && over_load_factor()) {
+            make_room();
+        }
+        return true;
+    }
+
+    // Dozwolony zakres: (1, GROWTH_FACTOR_LIMIT].
+    bool set_growth_factor(double value) override {
+        if (!(value > 1.0 && value <= GROWTH_FACTOR_LIMIT)) return false;
+        growth_factor = value;
+        return true;
+    }
+
+    double get_max_load_factor() const override { return max_load_factor; }
+
+    double get_growth_factor() const override { return growth_factor; }
+
+    // Czyści tabele w czasie O(1): nowa generacja sprawia, ze wszystkie wpisy czytaja sie jako EMPTY.
+    void clear() override {
+        clear(false);
+    }
+
+    // Czyści tabele; przy 'release_storage' zwalnia tez pamiec slotow.
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            std::vector<Entry>().swap(table); // Zwolnij sloty
+        }
+        else if (++generation == 0) {
+            // Licznik generacji sie przekrecil - raz na 65535 wywolan wyzeruj sloty naprawde
+            for (auto& entry : table) {
+                entry = Entry();
+            }
+            generation = 1;
+        }
+        current_size = 0; // Zresetuj licznik elementow
+        tombstones = 0;
+    }
+
+    // Zwraca nazwe implementacji tabeli hashujacej.
+    // Uwaga: Tutaj powinno byc "Open Addressing Hash Table", a nie "AVL Hash Table".
+    std::string get_name() const override {
+        return "Open Addressing Hash Table";
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h).
+inline const bool open_addressing_hash_table_registered = register_engine({
+    "open", "Adresowanie otwarte", "Open Addressing", 10, 24.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new OpenAddressingHashTable(n)); } });
+
+#endif // OPEN_ADDRESSING_HASH_TABLE_H
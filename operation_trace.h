@@ -0,0 +1,325 @@
+#ifndef OPERATION_TRACE_H
+#define OPERATION_TRACE_H
+
+#include "hash_table_base.h" // Interfejs tabel, na ktorych odtwarzany jest zapis
+#include "benchmark_stats.h" // Mediana i przedzial ufnosci czasu odtwarzania
+#include <cstdint>  // int32_t, uint8_t, uint32_t, uint64_t
+#include <cstdio>   // std::FILE - zapis porcjami
+#include <cstring>  // std::memcmp, std::memcpy
+#include <fstream>  // Wczytanie pliku bez mmap
+#include <string>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap, madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+#define HASH_TABLE_HAVE_MMAP 1
+#endif
+
+// Binarny zapis operacji na tabeli (trace) - odtwarzanie rzeczywistych wzorcow dostepu
+// (lokalnosc, proporcje operacji, kolejnosc) zamiast kluczy syntetycznych.
+//
+// Plik: naglowek TraceHeader (32 bajty), a po nim record_count rekordow TraceRecord po 12 bajtow,
+// bez separatorow i bez kompresji. Liczby sa zapisywane w kolejnosci bajtow procesora
+// (little-endian na x86 i ARM) - plik przenosi sie miedzy maszynami o tej samej kolejnosci.
+// Rekordy sa wyrownane do 4 bajtow, wiec po zmapowaniu pliku (mmap) sa czytane wprost
+// z pamieci jako tablica TraceRecord - odtwarzanie nie parsuje tekstu ani nie kopiuje danych.
+//
+// Zapis: TraceWriter (tu) i dekorator RecordingHashTable (recording_hash_table.h), ktory
+// zapisuje kazda operacje opakowanej tabeli. Odtwarzanie: MappedTrace + replay_trace.
+
+// Rodzaj operacji w rekordzie.
+enum class TraceOperation : uint8_t {
+    INSERT = 0, // value - wstawiana wartosc
+    REMOVE = 1,
+    FIND = 2,   // find / find_ptr (nie-const); value - znaleziona wartosc (0 przy chybieniu)
+    CLEAR = 3   // key i value nieuzywane
+};
+
+inline const char* trace_operation_name(TraceOperation operation) {
+    static const char* names[] = { "insert", "remove", "find", "clear" };
+    return static_cast<unsigned int>(operation) < 4 ? names[static_cast<int>(operation)] : "unknown";
+}
+
+// Jedna operacja. 'result' to wynik zwrocony przez nagrywana tabele (1 - wstawiono/usunieto/
+// znaleziono); odtwarzanie porownuje go z wynikiem badanej tabeli.
+struct TraceRecord {
+    int32_t key;
+    int32_t value;
+    uint8_t operation; // TraceOperation
+    uint8_t result;
+    uint16_t reserved; // 0; wyrownanie do 12 bajtow
+};
+static_assert(sizeof(TraceRecord) == 12, "TraceRecord must be 12 bytes (file format)");
+
+struct TraceHeader {
+    char magic[8];         // TRACE_MAGIC
+    uint32_t version;      // TRACE_VERSION
+    uint32_t record_size;  // sizeof(TraceRecord)
+    uint64_t record_count;
+    uint64_t peak_size;    // Najwieksza liczba elementow nagrywanej tabeli (do wstepnego rozmiaru przy odtwarzaniu)
+};
+static_assert(sizeof(TraceHeader) == 32, "TraceHeader must be 32 bytes (file format)");
+
+inline constexpr char TRACE_MAGIC[8] = { 'H', 'T', 'T', 'R', 'A', 'C', 'E', '\0' };
+inline constexpr uint32_t TRACE_VERSION = 1;
+
+// Zapis pliku zapisu operacji. Rekordy sa buforowane i zapisywane porcjami; liczba rekordow
+// trafia do naglowka w close(). Plik niezamkniety przez close() (np. po awarii procesu)
+// ma w naglowku 0 rekordow i jest odrzucany przy odczycie.
+class TraceWriter {
+private:
+    static constexpr size_t BUFFER_RECORDS = 4096;
+
+    std::FILE* file = nullptr;
+    std::vector<TraceRecord> buffer;
+    uint64_t written = 0;   // Rekordy zapisane do pliku
+    uint64_t peak = 0;
+    bool failed = false;    // Blad zapisu - zglaszany przez close()
+
+    void flush() {
+        if (file && !buffer.empty() &&
+            std::fwrite(buffer.data(), sizeof(TraceRecord), buffer.size(), file) != buffer.size()) {
+            failed = true;
+        }
+        written += buffer.size();
+        buffer.clear();
+    }
+
+    bool write_header(uint64_t count) {
+        TraceHeader header;
+        std::memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+        header.version = TRACE_VERSION;
+        header.record_size = sizeof(TraceRecord);
+        header.record_count = count;
+        header.peak_size = peak;
+        return std::fwrite(&header, sizeof(header), 1, file) == 1;
+    }
+
+public:
+    TraceWriter() = default;
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    ~TraceWriter() {
+        std::string ignored;
+        close(ignored);
+    }
+
+    // Tworzy (lub nadpisuje) plik. Zwraca false i opis bledu w 'error'.
+    bool open(const std::string& path, std::string& error) {
+        std::string ignored;
+        close(ignored);
+        file = std::fopen(path.c_str(), "wb");
+        if (!file) {
+            error = "cannot create trace " + path;
+            return false;
+        }
+        buffer.reserve(BUFFER_RECORDS);
+        written = 0;
+        peak = 0;
+        failed = !write_header(0);
+        return true;
+    }
+
+    bool is_open() const { return file != nullptr; }
+
+    void append(TraceOperation operation, int key, int value, bool result) {
+        if (!file) return;
+        buffer.push_back(TraceRecord{ key, value, static_cast<uint8_t>(operation), static_cast<uint8_t>(result), 0 });
+        if (buffer.size() == BUFFER_RECORDS) {
+            flush();
+        }
+    }
+
+    // Zapamietuje liczbe elementow tabeli po operacji (maksimum trafia do naglowka).
+    void note_size(size_t size) {
+        if (size > peak) peak = size;
+    }
+
+    uint64_t record_count() const { return written + buffer.size(); }
+
+    // Zapisuje reszte rekordow i naglowek z ich liczba. Zwraca false, gdy ktorykolwiek zapis sie nie udal.
+    bool close(std::string& error) {
+        if (!file) return true;
+        flush();
+        bool ok = !failed && std::fseek(file, 0, SEEK_SET) == 0 && write_header(written);
+        ok = std::fclose(file) == 0 && ok;
+        file = nullptr;
+        if (!ok) error = "error writing trace";
+        return ok;
+    }
+};
+
+// Plik zapisu operacji zmapowany do pamieci tylko do odczytu. Bez mmap (poza POSIX) plik
+// jest wczytywany do pamieci w calosci - odtwarzanie dziala tak samo.
+class MappedTrace {
+private:
+    const TraceHeader* header = nullptr;
+    const TraceRecord* first = nullptr;
+    void* mapping = nullptr;
+    size_t mapping_bytes = 0;
+    std::vector<TraceRecord> storage; // Rekordy wczytane bez mmap
+    TraceHeader header_copy{};
+
+    // Sprawdza naglowek i zgodnosc rozmiaru pliku z liczba rekordow.
+    static bool valid_header(const TraceHeader& h, uint64_t file_bytes, std::string& error) {
+        if (std::memcmp(h.magic, TRACE_MAGIC, sizeof(h.magic)) != 0) {
+            error = "not a trace file";
+            return false;
+        }
+        if (h.version != TRACE_VERSION || h.record_size != sizeof(TraceRecord)) {
+            error = "unsupported trace version";
+            return false;
+        }
+        if (h.record_count > (file_bytes - sizeof(TraceHeader)) / sizeof(TraceRecord) ||
+            file_bytes != sizeof(TraceHeader) + h.record_count * sizeof(TraceRecord)) {
+            error = "trace size does not match its header (file truncated or not closed)";
+            return false;
+        }
+        return true;
+    }
+
+public:
+    MappedTrace() = default;
+    MappedTrace(const MappedTrace&) = delete;
+    MappedTrace& operator=(const MappedTrace&) = delete;
+
+    ~MappedTrace() { close(); }
+
+    // Otwiera plik; zwraca false i opis bledu w 'error'.
+    bool open(const std::string& path, std::string& error) {
+        close();
+#ifdef HASH_TABLE_HAVE_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            error = "cannot open trace " + path;
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < sizeof(TraceHeader)) {
+            ::close(fd);
+            error = "not a trace file: " + path;
+            return false;
+        }
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        flags |= MAP_POPULATE; // Strony wczytane od razu - bledy stron nie trafiaja do pomiaru
+#endif
+        void* address = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, flags, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            error = "cannot map trace " + path;
+            return false;
+        }
+        mapping = address;
+        mapping_bytes = static_cast<size_t>(info.st_size);
+        madvise(mapping, mapping_bytes, MADV_SEQUENTIAL);
+        header = static_cast<const TraceHeader*>(mapping);
+        first = reinterpret_cast<const TraceRecord*>(static_cast<const char*>(mapping) + sizeof(TraceHeader));
+        if (!valid_header(*header, mapping_bytes, error)) {
+            close();
+            error += ": " + path;
+            return false;
+        }
+        return true;
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            error = "cannot open trace " + path;
+            return false;
+        }
+        uint64_t file_bytes = static_cast<uint64_t>(in.tellg());
+        in.seekg(0);
+        if (file_bytes < sizeof(TraceHeader) || !in.read(reinterpret_cast<char*>(&header_copy), sizeof(header_copy)) ||
+            !valid_header(header_copy, file_bytes, error)) {
+            if (error.empty()) error = "not a trace file";
+            error += ": " + path;
+            return false;
+        }
+        storage.resize(static_cast<size_t>(header_copy.record_count));
+        if (!in.read(reinterpret_cast<char*>(storage.data()), static_cast<std::streamsize>(storage.size() * sizeof(TraceRecord)))) {
+            error = "cannot read trace " + path;
+            storage.clear();
+            return false;
+        }
+        header = &header_copy;
+        first = storage.data();
+        return true;
+#endif
+    }
+
+    void close() {
+#ifdef HASH_TABLE_HAVE_MMAP
+        if (mapping) munmap(mapping, mapping_bytes);
+#endif
+        mapping = nullptr;
+        mapping_bytes = 0;
+        storage.clear();
+        header = nullptr;
+        first = nullptr;
+    }
+
+    const TraceRecord* records() const { return first; }
+    size_t size() const { return header ? static_cast<size_t>(header->record_count) : 0; }
+    uint64_t peak_size() const { return header ? header->peak_size : 0; }
+
+    // Liczba rekordow danego rodzaju.
+    uint64_t count(TraceOperation operation) const {
+        uint64_t total = 0;
+        for (size_t i = 0; i < size(); ++i) {
+            total += first[i].operation == static_cast<uint8_t>(operation);
+        }
+        return total;
+    }
+};
+
+// Wykonuje 'count' rekordow na tabeli. Zwraca liczbe operacji, ktorych wynik (wstawiono,
+// usunieto, znaleziono) rozni sie od zapisanego - dla poprawnej tabeli odtwarzanej od pustej 0.
+// Wartosci znalezione nie sa porownywane: zapis przez wskaznik z find_ptr nie jest nagrywany.
+inline uint64_t replay_trace(HashTableBase& table, const TraceRecord* records, size_t count, long long& sink) {
+    uint64_t mismatches = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const TraceRecord& record = records[i];
+        bool result = false;
+        switch (static_cast<TraceOperation>(record.operation)) {
+        case TraceOperation::INSERT:
+            result = table.insert(record.key, record.value);
+            break;
+        case TraceOperation::REMOVE:
+            result = table.remove(record.key);
+            break;
+        case TraceOperation::FIND: {
+            const int* value = table.find_ptr(record.key);
+            result = value != nullptr;
+            sink += result ? *value : 0;
+            break;
+        }
+        case TraceOperation::CLEAR:
+            table.clear();
+            result = true;
+            break;
+        }
+        mismatches += result != (record.result != 0);
+    }
+    return mismatches;
+}
+
+// Wynik odtwarzania zapisu na jednym silniku.
+struct TraceReplayResult {
+    std::string engine;
+    uint64_t records = 0;
+    uint64_t mismatches = 0;       // Operacje z innym wynikiem niz w zapisie (pierwsze odtworzenie)
+    size_t table_bytes = 0;        // memory_usage() po odtworzeniu calego zapisu
+    std::vector<double> ns_per_op; // Sredni czas operacji w kazdym powtorzeniu
+
+    SampleSummary summary() const { return summarize_samples(ns_per_op); }
+
+    double mops() const {
+        double median = summary().median;
+        return median > 0 ? 1e3 / median : 0.0;
+    }
+};
+
+#endif // OPERATION_TRACE_H
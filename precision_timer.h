@@ -0,0 +1,172 @@
+#ifndef PRECISION_TIMER_H
+#define PRECISION_TIMER_H
+
+#include <algorithm> // std::min
+#include <chrono>    // steady_clock - ostatnia deska ratunku
+#include <cstdint>   // uint64_t
+#include <cstdio>    // std::snprintf
+#include <cstdlib>   // std::getenv
+#include <string>
+#include <time.h>    // clock_gettime(CLOCK_MONOTONIC_RAW)
+
+// Licznik TSC jest dostepny tylko na x86.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define HASH_TABLE_HAVE_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>    // __rdtsc, __rdtscp, _mm_lfence, __cpuid
+#else
+#include <cpuid.h>     // __get_cpuid
+#include <x86intrin.h> // __rdtsc, __rdtscp, _mm_lfence
+#endif
+#endif
+
+// Zegar do pomiaru krotkich odcinkow (nawet pojedynczych operacji na tabeli).
+// std::chrono::high_resolution_clock kosztuje 20-30 ns na odczyt, co przy operacjach
+// trwajacych kilkadziesiat nanosekund zaklamuje wynik. Ten zegar:
+//  - czyta licznik cykli TSC instrukcja rdtscp, z lfence, aby mierzony kod nie
+//    wyprzedzal odczytow ani nie byl przez nie wyprzedzany,
+//  - przelicza cykle na nanosekundy czestotliwoscia TSC zmierzona wzgledem CLOCK_MONOTONIC_RAW,
+//  - mierzy koszt pary start()/stop() i odejmuje go od kazdego wyniku.
+// Gdy TSC nie jest niezmienny (invariant TSC - stala czestotliwosc niezalezna od
+// oszczedzania energii) albo procesor nie jest x86, uzywany jest clock_gettime(CLOCK_MONOTONIC_RAW).
+// Zmienna srodowiskowa HASH_TABLE_TIMER=clock wymusza zegar systemowy.
+class PrecisionTimer {
+private:
+    bool use_tsc;
+    double ns_per_tick;    // Dlugosc jednego tykniecia w ns (dla zegara systemowego 1)
+    uint64_t overhead;     // Koszt pary start()/stop() w tyknieciach
+
+    static constexpr int OVERHEAD_SAMPLES = 10000;
+    static constexpr double CALIBRATION_NS = 20e6; // 20 ms kalibracji czestotliwosci TSC
+
+    // Czas zegara systemowego w ns.
+    static uint64_t clock_ns() {
+#ifdef CLOCK_MONOTONIC_RAW
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // Czy procesor ma niezmienny TSC (CPUID 0x80000007, EDX bit 8) i instrukcje rdtscp
+    // (CPUID 0x80000001, EDX bit 27).
+    static bool tsc_usable() {
+#if defined(HASH_TABLE_HAVE_TSC) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0x80000000);
+        if (static_cast<unsigned int>(info[0]) < 0x80000007u) return false;
+        __cpuid(info, 0x80000001);
+        bool rdtscp = (info[3] & (1 << 27)) != 0;
+        __cpuid(info, 0x80000007);
+        return rdtscp && (info[3] & (1 << 8)) != 0;
+#elif defined(HASH_TABLE_HAVE_TSC)
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 27))) return false;
+        return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8));
+#else
+        return false;
+#endif
+    }
+
+    // Liczy dlugosc tykniecia TSC: tykniecia i czas systemowy w tym samym odcinku ok. 20 ms.
+    void calibrate() {
+        uint64_t clock_start = clock_ns();
+        uint64_t tsc_start = start();
+        uint64_t clock_end;
+        do {
+            clock_end = clock_ns();
+        } while (clock_end - clock_start < CALIBRATION_NS);
+        uint64_t tsc_end = stop();
+        ns_per_tick = static_cast<double>(clock_end - clock_start) / static_cast<double>(tsc_end - tsc_start);
+    }
+
+    // Minimalny odstep miedzy start() i stop() bez kodu pomiedzy (minimum odrzuca przerwania).
+    void measure_overhead() {
+        uint64_t best = UINT64_MAX;
+        for (int i = 0; i < OVERHEAD_SAMPLES; ++i) {
+            uint64_t begin = start();
+            uint64_t end = stop();
+            best = std::min(best, end - begin);
+        }
+        overhead = best;
+    }
+
+public:
+    PrecisionTimer() : use_tsc(false), ns_per_tick(1.0), overhead(0) {
+        const char* env = std::getenv("HASH_TABLE_TIMER");
+        use_tsc = tsc_usable() && !(env && std::string(env) == "clock");
+        if (use_tsc) {
+            calibrate();
+        }
+        measure_overhead();
+    }
+
+    // Odczyt na poczatku mierzonego odcinka. lfence po odczycie nie pozwala mierzonemu
+    // kodowi zaczac sie przed nim, lfence przed - aby wczesniejszy kod nie wpadl do pomiaru.
+    uint64_t start() const {
+#ifdef HASH_TABLE_HAVE_TSC
+        if (use_tsc) {
+            _mm_lfence();
+            uint64_t ticks = __rdtsc();
+            _mm_lfence();
+            return ticks;
+        }
+#endif
+        return clock_ns();
+    }
+
+    // Odczyt na koncu odcinka. rdtscp czeka na zakonczenie wczesniejszych instrukcji,
+    // lfence po nim nie pozwala kolejnemu kodowi wykonac sie przed odczytem.
+    uint64_t stop() const {
+#ifdef HASH_TABLE_HAVE_TSC
+        if (use_tsc) {
+            unsigned int aux;
+            uint64_t ticks = __rdtscp(&aux);
+            _mm_lfence();
+            return ticks;
+        }
+#endif
+        return clock_ns();
+    }
+
+    // Czas odcinka w ns po odjeciu kosztu samego pomiaru (nie mniej niz 0).
+    double elapsed_ns(uint64_t begin, uint64_t end) const {
+        uint64_t ticks = end - begin;
+        return ticks > overhead ? static_cast<double>(ticks - overhead) * ns_per_tick : 0.0;
+    }
+
+    // Dlugosc tykniecia w ns (np. do przeliczania histogramow w tyknieciach).
+    double tick_ns() const { return ns_per_tick; }
+
+    // Koszt pary start()/stop() w ns.
+    double overhead_ns() const { return static_cast<double>(overhead) * ns_per_tick; }
+
+    bool uses_tsc() const { return use_tsc; }
+
+    // Opis do raportow, np. "TSC rdtscp, 2.90 GHz, overhead 9.3 ns".
+    std::string description() const {
+        char text[96];
+        if (use_tsc) {
+            std::snprintf(text, sizeof(text), "TSC rdtscp, %.2f GHz, overhead %.1f ns", 1.0 / ns_per_tick, overhead_ns());
+        }
+        else {
+#ifdef CLOCK_MONOTONIC_RAW
+            std::snprintf(text, sizeof(text), "CLOCK_MONOTONIC_RAW, overhead %.1f ns", overhead_ns());
+#else
+            std::snprintf(text, sizeof(text), "steady_clock, overhead %.1f ns", overhead_ns());
+#endif
+        }
+        return text;
+    }
+};
+
+// Wspolny, skalibrowany zegar (kalibracja ok. 20 ms przy pierwszym wywolaniu).
+inline const PrecisionTimer& precision_timer() {
+    static const PrecisionTimer timer;
+    return timer;
+}
+
+#endif // PRECISION_TIMER_H
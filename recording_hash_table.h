@@ -0,0 +1,101 @@
+#ifndef RECORDING_HASH_TABLE_H
+#define RECORDING_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "operation_trace.h" // TraceWriter, format rekordow
+#include <memory> // std::unique_ptr dla opakowywanej tabeli
+
+// Dekorator nagrywajacy operacje opakowanej tabeli do pliku zapisu (operation_trace.h).
+// Serwis podmienia swoja tabele na RecordingHashTable na czas zbierania zapisu:
+//
+//   TraceWriter writer;
+//   if (!writer.open("service.htr", error)) ...
+//   RecordingHashTable table(std::make_unique<ChainingHashTable>(), writer);
+//   ... normalna praca serwisu ...
+//   writer.close(error);
+//
+// a benchmark odtwarza zapis na dowolnym silniku (--replay=service.htr). Nagrywane sa insert,
+// remove, find/find_ptr i clear wraz z ich wynikiem; for_each, display oraz wyszukiwania przez
+// const (const find_ptr, contains) nie zmieniaja obiektu, wiec nie sa nagrywane. Koszt: jeden zapis
+// 12-bajtowego rekordu do bufora na operacje (co 4096 rekordow zapis do pliku).
+class RecordingHashTable : public HashTableBase {
+private:
+    std::unique_ptr<HashTableBase> inner; // Wlasciwa tabela
+    TraceWriter& writer;                  // Musi zyc dluzej niz dekorator
+
+public:
+    RecordingHashTable(std::unique_ptr<HashTableBase> inner_table, TraceWriter& trace_writer)
+        : inner(std::move(inner_table)), writer(trace_writer) {}
+
+    bool insert(int key, int value) override {
+        bool inserted = inner->insert(key, value);
+        writer.append(TraceOperation::INSERT, key, value, inserted);
+        writer.note_size(inner->size());
+        return inserted;
+    }
+
+    bool remove(int key) override {
+        bool removed = inner->remove(key);
+        writer.append(TraceOperation::REMOVE, key, 0, removed);
+        return removed;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Zapisywana jest wartosc w chwili wyszukania; zmiany przez zwrocony wskaznik nie sa nagrywane.
+    int* find_ptr(int key) override {
+        int* found = inner->find_ptr(key);
+        writer.append(TraceOperation::FIND, key, found ? *found : 0, found != nullptr);
+        return found;
+    }
+
+    // Bez nagrywania: wyszukiwania przez const moga byc wykonywane z wielu watkow naraz.
+    const int* find_ptr(int key) const override {
+        return static_cast<const HashTableBase&>(*inner).find_ptr(key);
+    }
+
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        inner->for_each(visit);
+    }
+
+    void display() override {
+        inner->display();
+        std::cout << "Recorded operations: " << writer.record_count() << std::endl;
+    }
+
+    size_t size() const override { return inner->size(); }
+
+    size_t memory_usage() const override { return sizeof(*this) + inner->memory_usage(); }
+
+    bool probe_stats(ProbeStats& stats) const override { return inner->probe_stats(stats); }
+
+    bool set_max_load_factor(double value) override { return inner->set_max_load_factor(value); }
+
+    bool set_growth_factor(double value) override { return inner->set_growth_factor(value); }
+
+    double get_max_load_factor() const override { return inner->get_max_load_factor(); }
+
+    double get_growth_factor() const override { return inner->get_growth_factor(); }
+
+    void clear() override {
+        clear(false);
+    }
+
+    void clear(bool release_storage) override {
+        inner->clear(release_storage);
+        writer.append(TraceOperation::CLEAR, 0, 0, true);
+    }
+
+    std::string get_name() const override {
+        return "Recording + " + inner->get_name();
+    }
+};
+
+#endif // RECORDING_HASH_TABLE_H
@@ -0,0 +1,78 @@
+#ifndef SIMD_HASH_H
+#define SIMD_HASH_H
+
+#include "hash_table_base.h" // mix_hash - wersja skalarna i wzorzec dla wersji SIMD
+#include "simd_scan.h"       // Makra HASH_TABLE_HAVE_SSE2 / HASH_TABLE_HAVE_AVX i HASH_TABLE_TARGET
+
+// Jadra liczace mix_hash(keys[i], seed) dla calej tablicy kluczy naraz (np. przy budowie
+// tabeli statycznej). Kazda wersja daje wyniki identyczne z mix_hash; wersje dla danego
+// procesora wybiera cpu_dispatch.h. Pojedyncze wyszukiwania dalej uzywaja skalarnego
+// mix_hash - dla jednego klucza przejscie do rejestrow wektorowych nic nie daje.
+
+inline void mix_hash_batch_scalar(const int* keys, size_t count, unsigned int seed, unsigned int* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = mix_hash(keys[i], seed);
+    }
+}
+
+#ifdef HASH_TABLE_HAVE_SSE2
+// SSE2 nie ma mnozenia 32-bitowego (_mm_mullo_epi32 to SSE4.1): mnozymy parzyste
+// i nieparzyste pozycje osobno (_mm_mul_epu32) i skladamy mlodsze polowy wynikow.
+inline __m128i mullo_epi32_sse2(__m128i a, __m128i b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// Wersja SSE2: 4 klucze naraz, reszta skalarnie.
+inline void mix_hash_batch_sse2(const int* keys, size_t count, unsigned int seed, unsigned int* out) {
+    const __m128i salt = _mm_set1_epi32(static_cast<int>(seed * 0x9e3779b9u));
+    const __m128i multiplier = _mm_set1_epi32(0x45d9f3b);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i h = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), salt);
+        h = mullo_epi32_sse2(_mm_xor_si128(_mm_srli_epi32(h, 16), h), multiplier);
+        h = mullo_epi32_sse2(_mm_xor_si128(_mm_srli_epi32(h, 16), h), multiplier);
+        h = _mm_xor_si128(_mm_srli_epi32(h, 16), h);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), h);
+    }
+    mix_hash_batch_scalar(keys + i, count - i, seed, out + i);
+}
+#endif
+
+#ifdef HASH_TABLE_HAVE_AVX
+// Wersja AVX2: 8 kluczy naraz, reszta przez SSE2.
+HASH_TABLE_TARGET("avx2")
+inline void mix_hash_batch_avx2(const int* keys, size_t count, unsigned int seed, unsigned int* out) {
+    const __m256i salt = _mm256_set1_epi32(static_cast<int>(seed * 0x9e3779b9u));
+    const __m256i multiplier = _mm256_set1_epi32(0x45d9f3b);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i h = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), salt);
+        h = _mm256_mullo_epi32(_mm256_xor_si256(_mm256_srli_epi32(h, 16), h), multiplier);
+        h = _mm256_mullo_epi32(_mm256_xor_si256(_mm256_srli_epi32(h, 16), h), multiplier);
+        h = _mm256_xor_si256(_mm256_srli_epi32(h, 16), h);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), h);
+    }
+    mix_hash_batch_sse2(keys + i, count - i, seed, out + i);
+}
+
+// Wersja AVX-512: 16 kluczy naraz, koncowka z maska.
+HASH_TABLE_TARGET("avx512f")
+inline void mix_hash_batch_avx512(const int* keys, size_t count, unsigned int seed, unsigned int* out) {
+    const __m512i salt = _mm512_set1_epi32(static_cast<int>(seed * 0x9e3779b9u));
+    const __m512i multiplier = _mm512_set1_epi32(0x45d9f3b);
+    for (size_t i = 0; i < count; i += 16) {
+        __mmask16 lanes = count - i >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                          : static_cast<__mmask16>((1u << (count - i)) - 1);
+        __m512i h = _mm512_xor_si512(_mm512_maskz_loadu_epi32(lanes, keys + i), salt);
+        h = _mm512_mullo_epi32(_mm512_xor_si512(_mm512_maskz_srli_epi32(lanes, h, 16), h), multiplier);
+        h = _mm512_mullo_epi32(_mm512_xor_si512(_mm512_maskz_srli_epi32(lanes, h, 16), h), multiplier);
+        h = _mm512_xor_si512(_mm512_maskz_srli_epi32(lanes, h, 16), h);
+        _mm512_mask_storeu_epi32(out + i, lanes, h);
+    }
+}
+#endif
+
+#endif // SIMD_HASH_H
@@ -0,0 +1,357 @@
+#ifndef SIMD_SCAN_H
+#define SIMD_SCAN_H
+
+#include <cstddef> // size_t
+
+// Jadra (kernels) do liniowego przeszukiwania malych, ciaglych tablic kluczy
+// i 8-bitowych znacznikow (tagow) hasha. Wersje SSE2 porownuja 4 klucze lub 16 tagow
+// jedna instrukcja, AVX2 - 8 kluczy lub 32 tagi, AVX-512 - 16 kluczy. Wersje AVX sa
+// kompilowane atrybutem 'target' (bez flag -mavx2 dla calego programu); wersje dla
+// danego procesora wybiera cpu_dispatch.h. Gdy SIMD nie jest dostepne (inna architektura),
+// uzywana jest zwykla petla skalarna.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h> // Instrukcje SSE2
+#define HASH_TABLE_HAVE_SSE2 1
+#endif
+
+// Jadra AVX2/AVX-512 wymagaja kompilatora, ktory pozwala wlaczyc zestaw instrukcji
+// dla pojedynczej funkcji (GCC/Clang: __attribute__((target)), MSVC: zawsze).
+#if defined(HASH_TABLE_HAVE_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h> // Instrukcje AVX2 i AVX-512
+#define HASH_TABLE_HAVE_AVX 1
+#define HASH_TABLE_TARGET(isa) __attribute__((target(isa)))
+#elif defined(HASH_TABLE_HAVE_SSE2) && defined(_MSC_VER)
+#include <immintrin.h>
+#define HASH_TABLE_HAVE_AVX 1
+#define HASH_TABLE_TARGET(isa)
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h> // _BitScanForward, __cpuidex
+#endif
+
+// Zwraca indeks najmlodszego ustawionego bitu maski (maska musi byc niezerowa).
+inline unsigned int lowest_set_bit(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+}
+
+// Liczba ustawionych bitow maski.
+inline unsigned int set_bit_count(unsigned int mask) {
+#if defined(_MSC_VER)
+    return static_cast<unsigned int>(__popcnt(mask));
+#else
+    return static_cast<unsigned int>(__builtin_popcount(mask));
+#endif
+}
+
+// Najszerszy zestaw instrukcji SIMD obslugiwany przez procesor (i system operacyjny).
+enum class SimdLevel {
+    SCALAR,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+inline const char* simd_level_name(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::SSE2: return "SSE2";
+    case SimdLevel::AVX2: return "AVX2";
+    case SimdLevel::AVX512: return "AVX-512";
+    default: return "scalar";
+    }
+}
+
+// Sprawdza cechy procesora. AVX wymaga tez zgody systemu (zapis rejestrow YMM/ZMM
+// przy przelaczaniu watkow) - __builtin_cpu_supports sprawdza to sam, dla MSVC robi to xgetbv.
+inline SimdLevel detect_simd_level() {
+#if defined(HASH_TABLE_HAVE_AVX) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || max_leaf < 7) {
+        return SimdLevel::SSE2;
+    }
+    unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6) {
+        return SimdLevel::SSE2; // System nie zapisuje rejestrow YMM
+    }
+    __cpuidex(info, 7, 0);
+    if ((info[1] & (1 << 16)) && (xcr0 & 0xe6) == 0xe6) {
+        return SimdLevel::AVX512;
+    }
+    return (info[1] & (1 << 5)) ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#elif defined(HASH_TABLE_HAVE_AVX)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    return SimdLevel::SSE2;
+#elif defined(HASH_TABLE_HAVE_SSE2)
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Szukanie klucza w ciaglej tablicy int (uklad SoA: same klucze).
+
+// Wersja skalarna: zwraca indeks pierwszego wystapienia 'key' w keys[0..count) lub count.
+inline size_t find_int_scalar(const int* keys, size_t count, int key) {
+    for (size_t i = 0; i < count; ++i) {
+        if (keys[i] == key) {
+            return i;
+        }
+    }
+    return count;
+}
+
+#ifdef HASH_TABLE_HAVE_SSE2
+// Wersja SSE2: porownuje po 4 klucze naraz, reszta (count % 4) skalarnie.
+inline size_t find_int_sse2(const int* keys, size_t count, int key) {
+    const __m128i needle = _mm_set1_epi32(key);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+        if (mask) {
+            return i + lowest_set_bit(static_cast<unsigned int>(mask));
+        }
+    }
+    return i + find_int_scalar(keys + i, count - i, key);
+}
+#endif
+
+#ifdef HASH_TABLE_HAVE_AVX
+// Wersja AVX2: po 8 kluczy naraz, reszta przez SSE2.
+HASH_TABLE_TARGET("avx2")
+inline size_t find_int_avx2(const int* keys, size_t count, int key) {
+    const __m256i needle = _mm256_set1_epi32(key);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+        if (mask) {
+            return i + lowest_set_bit(static_cast<unsigned int>(mask));
+        }
+    }
+    return i + find_int_sse2(keys + i, count - i, key);
+}
+
+// Wersja AVX-512: po 16 kluczy naraz; koncowka jest wczytywana z maska
+// (odczyt pomija pozycje poza tablica), wiec nie ma petli skalarnej.
+HASH_TABLE_TARGET("avx512f")
+inline size_t find_int_avx512(const int* keys, size_t count, int key) {
+    const __m512i needle = _mm512_set1_epi32(key);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(keys + i), needle);
+        if (mask) {
+            return i + lowest_set_bit(mask);
+        }
+    }
+    if (i < count) {
+        __mmask16 tail = static_cast<__mmask16>((1u << (count - i)) - 1);
+        __mmask16 mask = _mm512_mask_cmpeq_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, keys + i), needle);
+        if (mask) {
+            return i + lowest_set_bit(mask);
+        }
+    }
+    return count;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// Pozycja w posortowanej rosnaco tablicy int (lower bound): liczba kluczy mniejszych od 'key',
+// czyli indeks pierwszego klucza >= 'key'. Zamiast wyszukiwania binarnego (zalezne od siebie,
+// trudne do przewidzenia skoki) porownywane sa wszystkie klucze naraz, a wynikiem jest liczba
+// bitow maski porownania - przy kilkunastu kluczach (jedna linia cache) to 1-4 instrukcje.
+
+inline size_t count_less_int_scalar(const int* keys, size_t count, int key) {
+    size_t less = 0;
+    for (size_t i = 0; i < count; ++i) {
+        less += keys[i] < key;
+    }
+    return less;
+}
+
+#ifdef HASH_TABLE_HAVE_SSE2
+// Wersja SSE2: po 4 klucze naraz, reszta skalarnie.
+inline size_t count_less_int_sse2(const int* keys, size_t count, int key) {
+    const __m128i needle = _mm_set1_epi32(key);
+    size_t less = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+        less += set_bit_count(static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(block, needle)))));
+    }
+    return less + count_less_int_scalar(keys + i, count - i, key);
+}
+#endif
+
+#ifdef HASH_TABLE_HAVE_AVX
+// Wersja AVX2: po 8 kluczy naraz, reszta przez SSE2.
+HASH_TABLE_TARGET("avx2")
+inline size_t count_less_int_avx2(const int* keys, size_t count, int key) {
+    const __m256i needle = _mm256_set1_epi32(key);
+    size_t less = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+        less += set_bit_count(static_cast<unsigned int>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, block)))));
+    }
+    return less + count_less_int_sse2(keys + i, count - i, key);
+}
+
+// Wersja AVX-512: po 16 kluczy naraz, koncowka wczytywana z maska.
+HASH_TABLE_TARGET("avx512f")
+inline size_t count_less_int_avx512(const int* keys, size_t count, int key) {
+    const __m512i needle = _mm512_set1_epi32(key);
+    size_t less = 0;
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        less += set_bit_count(_mm512_cmplt_epi32_mask(_mm512_loadu_si512(keys + i), needle));
+    }
+    if (i < count) {
+        __mmask16 tail = static_cast<__mmask16>((1u << (count - i)) - 1);
+        less += set_bit_count(_mm512_mask_cmplt_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, keys + i), needle));
+    }
+    return less;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// Szukanie klucza w tablicy par (klucz, wartosc) (uklad AoS): pairs[2*i] to klucz
+// i-tej pary. Porownywane sa cale wektory, a maska jest ograniczana do pozycji kluczy.
+
+inline size_t find_pair_key_scalar(const int* pairs, size_t count, int key) {
+    for (size_t i = 0; i < count; ++i) {
+        if (pairs[2 * i] == key) {
+            return i;
+        }
+    }
+    return count;
+}
+
+#ifdef HASH_TABLE_HAVE_SSE2
+// Wersja SSE2: 2 pary na instrukcje.
+inline size_t find_pair_key_sse2(const int* pairs, size_t count, int key) {
+    const __m128i needle = _mm_set1_epi32(key);
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pairs + 2 * i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))) & 0x5;
+        if (mask) {
+            return i + lowest_set_bit(static_cast<unsigned int>(mask)) / 2;
+        }
+    }
+    return i + find_pair_key_scalar(pairs + 2 * i, count - i, key);
+}
+#endif
+
+#ifdef HASH_TABLE_HAVE_AVX
+// Wersja AVX2: 4 pary na instrukcje.
+HASH_TABLE_TARGET("avx2")
+inline size_t find_pair_key_avx2(const int* pairs, size_t count, int key) {
+    const __m256i needle = _mm256_set1_epi32(key);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pairs + 2 * i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle))) & 0x55;
+        if (mask) {
+            return i + lowest_set_bit(static_cast<unsigned int>(mask)) / 2;
+        }
+    }
+    return i + find_pair_key_sse2(pairs + 2 * i, count - i, key);
+}
+
+// Wersja AVX-512: 8 par na instrukcje, koncowka wczytywana z maska.
+HASH_TABLE_TARGET("avx512f")
+inline size_t find_pair_key_avx512(const int* pairs, size_t count, int key) {
+    const __m512i needle = _mm512_set1_epi32(key);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(pairs + 2 * i), needle) & 0x5555;
+        if (mask) {
+            return i + lowest_set_bit(mask) / 2;
+        }
+    }
+    if (i < count) {
+        __mmask16 tail = static_cast<__mmask16>((1u << (2 * (count - i))) - 1);
+        __mmask16 mask = _mm512_mask_cmpeq_epi32_mask(tail & 0x5555, _mm512_maskz_loadu_epi32(tail, pairs + 2 * i), needle);
+        if (mask) {
+            return i + lowest_set_bit(mask) / 2;
+        }
+    }
+    return count;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// Porownywanie 8-bitowych znacznikow.
+
+// Wersja skalarna: maska bitowa pozycji w bytes[0..count) (count <= 32) rownych 'byte'.
+inline unsigned int match_bytes_scalar(const unsigned char* bytes, size_t count, unsigned char byte) {
+    unsigned int mask = 0;
+    for (size_t i = 0; i < count; ++i) {
+        mask |= static_cast<unsigned int>(bytes[i] == byte) << i;
+    }
+    return mask;
+}
+
+#ifdef HASH_TABLE_HAVE_SSE2
+// Wersja SSE2: porownuje 16 bajtow jedna instrukcja (dokladnie 16 bajtow pod 'bytes').
+inline unsigned int match_bytes16_sse2(const unsigned char* bytes, unsigned char byte) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    __m128i eq = _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(byte)));
+    return static_cast<unsigned int>(_mm_movemask_epi8(eq));
+}
+#endif
+
+// Maska pozycji w bytes[0..count) (count <= 16) rownych 'byte'. Pelne grupy 16 bajtow
+// sa porownywane SIMD; krotsze koncowki skalarnie, aby nie czytac poza tablica.
+inline unsigned int match_bytes16(const unsigned char* bytes, size_t count, unsigned char byte) {
+#ifdef HASH_TABLE_HAVE_SSE2
+    if (count == 16) {
+        return match_bytes16_sse2(bytes, byte);
+    }
+#endif
+    return match_bytes_scalar(bytes, count, byte);
+}
+
+// Maska pozycji w bytes[0..count) (count <= 32): dwie polowki po 16 bajtow.
+inline unsigned int match_bytes32_halves(const unsigned char* bytes, size_t count, unsigned char byte) {
+    if (count <= 16) {
+        return match_bytes16(bytes, count, byte);
+    }
+    return match_bytes16(bytes, 16, byte) | (match_bytes16(bytes + 16, count - 16, byte) << 16);
+}
+
+#ifdef HASH_TABLE_HAVE_AVX
+// Wersja AVX2: pelna grupa 32 bajtow jedna instrukcja, krotsza - polowkami.
+HASH_TABLE_TARGET("avx2")
+inline unsigned int match_bytes32_avx2(const unsigned char* bytes, size_t count, unsigned char byte) {
+    if (count != 32) {
+        return match_bytes32_halves(bytes, count, byte);
+    }
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+    __m256i eq = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(static_cast<char>(byte)));
+    return static_cast<unsigned int>(_mm256_movemask_epi8(eq));
+}
+#endif
+
+#endif // SIMD_SCAN_H
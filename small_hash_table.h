@@ -0,0 +1,214 @@
+#ifndef SMALL_HASH_TABLE_H
+#define SMALL_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "cpu_dispatch.h"    // Wektorowe przeszukiwanie kluczy trzymanych w obiekcie
+#include "chaining_hash_table.h" // Wariant rejestrowany w benchmarkach
+#include "engine_registry.h"  // Rejestracja w benchmarkach i demonstracji
+#include <algorithm> // std::max
+#include <array>  // Tablice kluczy i wartosci przechowywane bezposrednio w obiekcie
+#include <memory> // std::unique_ptr dla wlasciwej tabeli hashujacej
+
+// Tabela z optymalizacja dla malych rozmiarow (small-size optimization).
+// Pierwsze 'InlineCapacity' elementow jest trzymanych bezposrednio w obiekcie (bez sterty)
+// i przeszukiwanych liniowo porownaniem SIMD. Dopiero gdy elementow jest wiecej,
+// tworzona jest wlasciwa tabela 'Table' (np. ChainingHashTable), do ktorej trafiaja
+// wszystkie elementy. Miliony malych map nie kosztuja wtedy po jednej alokacji kazda.
+//
+// Po przejsciu do duzej tabeli obiekt juz do trybu malego nie wraca (takze po clear),
+// aby naprzemienne wstawianie i usuwanie na granicy nie powodowalo ciaglych alokacji.
+template <class Table, size_t InlineCapacity = 16>
+class SmallHashTable : public HashTableBase {
+    static_assert(InlineCapacity > 0, "SmallHashTable wymaga InlineCapacity > 0");
+
+private:
+    alignas(16) std::array<int, InlineCapacity> inline_keys;  // Klucze w trybie malym (ciagle - dla SIMD)
+    std::array<int, InlineCapacity> inline_values;            // Wartosci odpowiadajace kluczom
+    size_t inline_count;          // Liczba elementow w trybie malym
+    size_t initial_size;          // Poczatkowa pojemnosc przekazywana do wlasciwej tabeli
+    std::unique_ptr<Table> table; // Wlasciwa tabela; nullptr dopoki obiekt jest w trybie malym
+    double max_load_factor;       // Ustawienia dla wlasciwej tabeli (0 - domyslne tabeli 'Table')
+    double growth_factor;
+
+    // Przenosi elementy z pamieci wewnetrznej do nowo utworzonej wlasciwej tabeli.
+    void grow() {
+        table = std::make_unique<Table>(std::max(initial_size, 2 * InlineCapacity));
+        if (max_load_factor > 0) table->set_max_load_factor(max_load_factor);
+        if (growth_factor > 0) table->set_growth_factor(growth_factor);
+        for (size_t i = 0; i < inline_count; ++i) {
+            table->insert(inline_keys[i], inline_values[i]);
+        }
+        inline_count = 0;
+    }
+
+public:
+    // 'initial_size' jest uzywany dopiero przy tworzeniu wlasciwej tabeli.
+    explicit SmallHashTable(size_t initial_size = 16)
+        : inline_count(0), initial_size(initial_size), max_load_factor(0), growth_factor(0) {}
+
+    bool insert(int key, int value) override {
+        if (table) {
+            return table->insert(key, value);
+        }
+
+        size_t index = find_int(inline_keys.data(), inline_count, key);
+        if (index < inline_count) {
+            inline_values[index] = value; // Aktualizuj wartosc
+            return true;
+        }
+
+        if (inline_count == InlineCapacity) {
+            grow(); // Brak miejsca w obiekcie - przejdz do wlasciwej tabeli
+            return table->insert(key, value);
+        }
+
+        inline_keys[inline_count] = key;
+        inline_values[inline_count] = value;
+        inline_count++;
+        return true;
+    }
+
+    bool remove(int key) override {
+        if (table) {
+            return table->remove(key);
+        }
+
+        size_t index = find_int(inline_keys.data(), inline_count, key);
+        if (index == inline_count) {
+            return false;
+        }
+
+        // Przenies ostatni element w miejsce usuwanego (kolejnosc nie ma znaczenia)
+        inline_count--;
+        inline_keys[index] = inline_keys[inline_count];
+        inline_values[index] = inline_values[inline_count];
+        return true;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // W trybie malym wskaznik jest wazny do najblizszego insert lub remove
+    // (usuwanie przenosi ostatni element, przejscie do duzej tabeli przenosi wszystkie).
+    // W trybie duzym obowiazuja gwarancje tabeli 'Table'.
+    int* find_ptr(int key) override {
+        if (table) {
+            return table->find_ptr(key);
+        }
+
+        size_t index = find_int(inline_keys.data(), inline_count, key);
+        return index < inline_count ? &inline_values[index] : nullptr;
+    }
+
+    // Wersja const wywoluje const find_ptr tabeli 'Table' (unique_ptr nie przenosi const na obiekt).
+    const int* find_ptr(int key) const override {
+        if (table) {
+            return static_cast<const Table&>(*table).find_ptr(key);
+        }
+
+        size_t index = find_int(inline_keys.data(), inline_count, key);
+        return index < inline_count ? &inline_values[index] : nullptr;
+    }
+
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        if (table) {
+            table->for_each(visit);
+            return;
+        }
+        for (size_t i = 0; i < inline_count; ++i) {
+            visit(inline_keys[i], inline_values[i]);
+        }
+    }
+
+    void display() override {
+        if (table) {
+            table->display();
+            return;
+        }
+
+        std::cout << "=== " << get_name() << " (inline storage) ===" << std::endl;
+        for (size_t i = 0; i < inline_count; ++i) {
+            std::cout << "(" << inline_keys[i] << "," << inline_values[i] << ") ";
+        }
+        std::cout << std::endl;
+        std::cout << "Size: " << inline_count << "/" << InlineCapacity << std::endl;
+    }
+
+    size_t size() const override {
+        return table ? table->size() : inline_count;
+    }
+
+    // Pamiec wewnetrzna jest czescia obiektu; w trybie duzym dochodzi wlasciwa tabela.
+    size_t memory_usage() const override {
+        return sizeof(*this) + (table ? heap_block_bytes(sizeof(Table)) - sizeof(Table) + table->memory_usage() : 0);
+    }
+
+    // W trybie malym przeszukiwanie liniowe (porownania kluczy, bez uwzglednienia SIMD).
+    bool probe_stats(ProbeStats& stats) const override {
+        if (table) {
+            return table->probe_stats(stats);
+        }
+        stats = ProbeStats();
+        stats.average_hit = inline_count ? (static_cast<double>(inline_count) + 1) / 2 : 0.0;
+        stats.average_miss = static_cast<double>(inline_count);
+        stats.max_hit = inline_count;
+        return true;
+    }
+
+    // Ustawienia wlasciwej tabeli. W trybie malym sa zapamietywane i stosowane przy jej utworzeniu
+    // (poprawnosc wartosci sprawdza pusta tabela 'Table' - nie alokuje pamieci).
+    bool set_max_load_factor(double value) override {
+        if (table ? !table->set_max_load_factor(value) : !Table(1).set_max_load_factor(value)) return false;
+        max_load_factor = value;
+        return true;
+    }
+
+    bool set_growth_factor(double value) override {
+        if (table ? !table->set_growth_factor(value) : !Table(1).set_growth_factor(value)) return false;
+        growth_factor = value;
+        return true;
+    }
+
+    double get_max_load_factor() const override {
+        return max_load_factor > 0 ? max_load_factor : Table(1).get_max_load_factor();
+    }
+
+    double get_growth_factor() const override {
+        return growth_factor > 0 ? growth_factor : Table(1).get_growth_factor();
+    }
+
+    void clear() override {
+        clear(false);
+    }
+
+    // Przy 'release_storage' wlasciwa tabela jest zwalniana i obiekt wraca do trybu malego.
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            table.reset();
+        }
+        else if (table) {
+            table->clear();
+        }
+        inline_count = 0;
+    }
+
+    // true, jesli elementy sa przechowywane w obiekcie (bez wlasciwej tabeli).
+    bool is_inline() const { return !table; }
+
+    std::string get_name() const override {
+        return "Small " + Table(1).get_name();
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h): mala tabela przed tabela z lancuchowaniem.
+inline const bool small_hash_table_registered = register_engine({
+    "small-chaining", "Mala tabela (lancuchowanie)", "Small Chaining", 40, 102.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new SmallHashTable<ChainingHashTable>(n)); } });
+
+#endif // SMALL_HASH_TABLE_H
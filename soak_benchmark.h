@@ -0,0 +1,162 @@
+#ifndef SOAK_BENCHMARK_H
+#define SOAK_BENCHMARK_H
+
+#include "hash_table_base.h" // Interfejs testowanych tabel, ProbeStats
+#include "key_generator.h"   // SplitMix64, ZipfGenerator, key_at
+#include "precision_timer.h" // Pomiar porcji operacji
+#include "cache_control.h"   // resident_memory_bytes
+#include <algorithm> // std::min
+#include <cstdint>   // uint32_t, uint64_t
+#include <functional> // Powiadamianie o kolejnych probkach
+#include <string>
+#include <vector>
+
+// Test dlugotrwalej wymiany kluczy (soak / churn). Tabela z 'size' elementami przez caly
+// przebieg ma stala liczbe elementow: kazda wymiana usuwa jeden obecny klucz i wstawia nowy,
+// nigdy wczesniej nieuzyty. Krotkie benchmarki nie pokazuja zjawisk, ktore narastaja
+// z czasem: slotow DELETED w adresowaniu otwartym, wektorow kubkow, ktore nigdy nie maleja,
+// fragmentacji sterty przez wezly drzew. Co 'interval' wymian zapisywana jest probka:
+// przepustowosc wymian, czas trafienia i chybienia, statystyki probkowania (probe_stats),
+// pamiec tabeli (memory_usage) i pamiec rezydentna procesu (RSS).
+//
+// Wybor usuwanego klucza: UNIFORM - losowy obecny klucz, SEQUENTIAL - najstarszy (okno
+// przesuwne kolejnych liczb), ZIPF - klucze z "goracych" pozycji wymieniane wielokrotnie.
+
+// Jedna probka przebiegu.
+struct SoakSample {
+    uint64_t operations = 0;  // Wymiany wykonane do chwili probki
+    double replace_mops = 0;  // Przepustowosc wymian od poprzedniej probki (mln wymian/s; wymiana = remove + insert)
+    double find_ns = 0;       // Sredni czas wyszukania obecnego klucza
+    double miss_ns = 0;       // Sredni czas wyszukania nieobecnego klucza
+    bool has_probe_stats = false;
+    ProbeStats probes;
+    size_t table_bytes = 0;   // memory_usage() tabeli
+    uint64_t rss_bytes = 0;   // Pamiec rezydentna procesu (0 - nieznana)
+};
+
+// Przebieg dla jednego silnika.
+struct SoakResult {
+    std::string engine;
+    uint64_t size = 0;        // Stala liczba elementow tabeli
+    KeyDistribution distribution = KeyDistribution::UNIFORM;
+    uint64_t operations = 0;  // Wymiany w calym przebiegu
+    std::vector<SoakSample> samples; // Pierwsza probka - stan tuz po zaladowaniu tabeli
+};
+
+class SoakBenchmark {
+private:
+    static constexpr size_t CHUNK = 4096;          // Wymiany przygotowywane porcjami poza pomiarem
+    static constexpr size_t LOOKUP_SAMPLE = 10000; // Wyszukiwania mierzone przy kazdej probce
+
+    HashTableBase& table;
+    uint64_t size;
+    KeyDistribution distribution;
+    SplitMix64 rng;
+    ZipfGenerator zipf;
+    std::vector<uint32_t> live; // Indeksy kluczy obecnych w tabeli (klucz = key_at(indeks))
+    uint64_t next_index;        // Indeks nastepnego nowego klucza
+    uint64_t replaced;          // Wykonane wymiany
+    long long sink = 0;
+
+    int key_of(uint64_t index) const { return key_at(index, distribution); }
+
+    // Pozycja w 'live' klucza do usuniecia w i-tej wymianie.
+    size_t pick_victim() {
+        switch (distribution) {
+        case KeyDistribution::SEQUENTIAL: return static_cast<size_t>(replaced % size); // Najstarszy klucz
+        case KeyDistribution::ZIPF: return static_cast<size_t>(zipf.next(rng));
+        default: return static_cast<size_t>(rng.below(size));
+        }
+    }
+
+    // Sredni czas wyszukania LOOKUP_SAMPLE kluczy (obecnych lub nieobecnych).
+    double time_lookups(bool hits) {
+        const PrecisionTimer& timer = precision_timer();
+        std::vector<int> keys(LOOKUP_SAMPLE);
+        for (size_t i = 0; i < LOOKUP_SAMPLE; ++i) {
+            // Chybienia: indeksy z gornego konca 32-bitowej przestrzeni, ktorych przebieg nie osiaga
+            keys[i] = hits ? key_of(live[rng.below(size)]) : key_of(MISS_BASE - rng.below(LOOKUP_SAMPLE));
+        }
+        uint64_t start = timer.start();
+        for (int key : keys) {
+            const int* value = table.find_ptr(key);
+            sink += value ? *value : 0;
+        }
+        return timer.elapsed_ns(start, timer.stop()) / LOOKUP_SAMPLE;
+    }
+
+    SoakSample take_sample(double replace_ns, uint64_t replacements) {
+        SoakSample sample;
+        sample.operations = replaced;
+        sample.replace_mops = replace_ns > 0 ? static_cast<double>(replacements) / replace_ns * 1e3 : 0.0;
+        sample.find_ns = time_lookups(true);
+        sample.miss_ns = time_lookups(false);
+        sample.has_probe_stats = table.probe_stats(sample.probes);
+        sample.table_bytes = table.memory_usage();
+        sample.rss_bytes = resident_memory_bytes();
+        return sample;
+    }
+
+public:
+    static constexpr uint64_t MISS_BASE = 0xFFFFFFFFull;              // Indeksy kluczy chybien (w dol)
+    static constexpr uint64_t MAX_INDEX = MISS_BASE - 2 * LOOKUP_SAMPLE; // Limit size + wymiany
+
+    // 'table' powinna byc pusta; 'size' > 0, size + operacje <= MAX_INDEX.
+    SoakBenchmark(HashTableBase& table, uint64_t size, KeyDistribution distribution, double zipf_exponent,
+                  uint64_t seed)
+        : table(table), size(size), distribution(distribution), rng(seed), zipf(size, zipf_exponent),
+          live(static_cast<size_t>(size)), next_index(size), replaced(0) {}
+
+    // Laduje tabele i wykonuje 'operations' wymian; po zaladowaniu i co 'interval' wymian
+    // dopisuje probke do 'result' i wywoluje 'on_sample' (np. wypisanie postepu).
+    void run(uint64_t operations, uint64_t interval, SoakResult& result,
+             const std::function<void(const SoakSample&)>& on_sample = nullptr) {
+        const PrecisionTimer& timer = precision_timer();
+        for (uint64_t i = 0; i < size; ++i) {
+            live[static_cast<size_t>(i)] = static_cast<uint32_t>(i);
+            table.insert(key_of(i), static_cast<int>(i));
+        }
+        result.size = size;
+        result.distribution = distribution;
+        result.operations = operations;
+        result.samples.push_back(take_sample(0, 0));
+        if (on_sample) on_sample(result.samples.back());
+
+        std::vector<int> removed(CHUNK);
+        std::vector<int> inserted(CHUNK);
+        double interval_ns = 0;
+        uint64_t in_interval = 0;
+        while (replaced < operations) {
+            size_t count = static_cast<size_t>(std::min<uint64_t>(CHUNK, std::min(operations - replaced,
+                                                                                 interval - in_interval)));
+            // Pary (usuwany, nowy) sa wyznaczane przed pomiarem; 'live' jest aktualizowane po kolei,
+            // wiec pozycja wybrana dwa razy w porcji usuwa za drugim razem klucz wstawiony za pierwszym
+            for (size_t i = 0; i < count; ++i) {
+                size_t victim = pick_victim();
+                removed[i] = key_of(live[victim]);
+                inserted[i] = key_of(next_index);
+                live[victim] = static_cast<uint32_t>(next_index++);
+                ++replaced;
+            }
+            uint64_t start = timer.start();
+            for (size_t i = 0; i < count; ++i) {
+                sink += table.remove(removed[i]);
+                table.insert(inserted[i], inserted[i]);
+            }
+            interval_ns += timer.elapsed_ns(start, timer.stop());
+            in_interval += count;
+
+            if (in_interval == interval || replaced == operations) {
+                result.samples.push_back(take_sample(interval_ns, in_interval));
+                if (on_sample) on_sample(result.samples.back());
+                interval_ns = 0;
+                in_interval = 0;
+            }
+        }
+    }
+
+    // Suma kontrolna wyszukiwan (zapobiega ich usunieciu przez kompilator).
+    long long checksum() const { return sink; }
+};
+
+#endif // SOAK_BENCHMARK_H
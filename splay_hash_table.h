@@ -0,0 +1,425 @@
+#ifndef SPLAY_HASH_TABLE_H
+#define SPLAY_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "node_arena.h"      // Pula wezlow z szybkim zwalnianiem wszystkich naraz
+#include "engine_registry.h" // Rejestracja w benchmarkach i demonstracji
+#include <algorithm> // std::max
+#include <cmath>     // std::ceil - nowy rozmiar przy wzroscie
+#include <cstdint>   // uint32_t dla licznika generacji
+#include <utility>   // std::pair na stosie przejsc drzewa
+#include <vector>    // Stos przejsc drzewa
+
+// Hash Table z kubelkami zawierajacymi drzewa splay (Sleator, Tarjan).
+// Alternatywa dla AVLHashTable przy skosnym rozkladzie dostepow: kazda operacja - takze
+// wyszukanie - przenosi odwiedzony wezel do korzenia drzewa kubelka, wiec gorace klucze sa
+// znajdowane po 1-2 porownaniach, a koszt zamortyzowany pozostaje logarytmiczny. Wezly nie
+// przechowuja wysokosci (24 B zamiast 32 B w AVL). Ceny: wyszukanie zapisuje do drzewa
+// (brak wspolbieznych odczytow), a przy rownomiernych dostepach kazdy find wykonuje
+// rotacje, ktorych AVL nie potrzebuje.
+class SplayHashTable : public HashTableBase {
+private:
+    struct SplayNode {
+        int key;
+        int value;
+        SplayNode* left;
+        SplayNode* right;
+
+        SplayNode(int k, int v) : key(k), value(v), left(nullptr), right(nullptr) {}
+    };
+
+    // Kubelek: korzen drzewa splay i generacja tabeli, w ktorej zostal zapisany.
+    // Korzen z innej generacji jest traktowany jako pusty (nullptr).
+    struct Bucket {
+        SplayNode* root = nullptr;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Bucket> table;  // Wektor korzeni drzew splay
+    size_t table_size;          // Liczba kubelkow
+    size_t current_size;        // Liczba elementow we wszystkich drzewach
+    uint32_t generation;        // Biezaca generacja tabeli (zwiekszana przez clear)
+    NodeArena<SplayNode> arena; // Pula, z ktorej pochodza wszystkie wezly tabeli
+    double max_load_factor;     // Wspolczynnik wypelnienia, po przekroczeniu ktorego tabela rosnie
+    double growth_factor;       // Krotnosc wzrostu liczby kubelkow przy resize()
+
+    static constexpr double DEFAULT_MAX_LOAD_FACTOR = 1.0;
+    static constexpr double LOAD_FACTOR_LIMIT = 64.0; // Gorna granica (sredni rozmiar drzewa)
+    static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
+    static constexpr double GROWTH_FACTOR_LIMIT = 4.0;
+
+    // Zwraca referencje do korzenia kubelka, zerujac go najpierw, jesli pochodzi z poprzedniej generacji.
+    SplayNode*& root_at(size_t index) {
+        Bucket& bucket = table[index];
+        if (bucket.generation != generation) {
+            bucket.root = nullptr;
+            bucket.generation = generation;
+        }
+        return bucket.root;
+    }
+
+    // Korzen kubelka bez modyfikacji tabeli: kubelek z poprzedniej generacji jest pusty.
+    SplayNode* live_root(size_t index) const {
+        const Bucket& bucket = table[index];
+        return bucket.generation == generation ? bucket.root : nullptr;
+    }
+
+    bool over_load_factor() const {
+        return static_cast<double>(current_size) / table_size > max_load_factor;
+    }
+
+    // Splay z gory na dol: schodzi od korzenia w strone 'key', odkladajac mijane poddrzewa do
+    // lewego (mniejsze klucze) i prawego (wieksze) drzewa pomocniczego, z rotacja przy dwoch
+    // krokach w te sama strone (zig-zig). Zwraca nowy korzen: wezel z kluczem 'key' albo ostatni
+    // wezel na sciezce (poprzednik lub nastepnik brakujacego klucza). Bez rekurencji i stosu.
+    static SplayNode* splay(SplayNode* root, int key) {
+        if (!root) return nullptr;
+        SplayNode header(0, 0);        // header.right - lewe drzewo, header.left - prawe drzewo
+        SplayNode* left_max = &header;  // Najwiekszy wezel lewego drzewa (doczepiamy na prawo)
+        SplayNode* right_min = &header; // Najmniejszy wezel prawego drzewa (doczepiamy na lewo)
+        for (;;) {
+            if (key < root->key) {
+                if (!root->left) break;
+                if (key < root->left->key) { // Zig-zig: rotacja w prawo
+                    SplayNode* child = root->left;
+                    root->left = child->right;
+                    child->right = root;
+                    root = child;
+                    if (!root->left) break;
+                }
+                right_min->left = root; // Korzen i jego prawe poddrzewo do prawego drzewa
+                right_min = root;
+                root = root->left;
+            }
+            else if (key > root->key) {
+                if (!root->right) break;
+                if (key > root->right->key) { // Zig-zig: rotacja w lewo
+                    SplayNode* child = root->right;
+                    root->right = child->left;
+                    child->left = root;
+                    root = child;
+                    if (!root->right) break;
+                }
+                left_max->right = root; // Korzen i jego lewe poddrzewo do lewego drzewa
+                left_max = root;
+                root = root->right;
+            }
+            else {
+                break;
+            }
+        }
+        // Zlozenie: poddrzewa nowego korzenia domykaja drzewa pomocnicze, ktore staja sie jego dziecmi
+        left_max->right = root->left;
+        right_min->left = root->right;
+        root->left = header.right;
+        root->right = header.left;
+        return root;
+    }
+
+    // Doczepia wezel 'fresh' (klucza nie ma w drzewie) jako nowy korzen po splay sasiada.
+    static SplayNode* insert_root(SplayNode* root, SplayNode* fresh) {
+        if (root) {
+            if (fresh->key < root->key) {
+                fresh->left = root->left;
+                fresh->right = root;
+                root->left = nullptr;
+            }
+            else {
+                fresh->right = root->right;
+                fresh->left = root;
+                root->right = nullptr;
+            }
+        }
+        return fresh;
+    }
+
+    // Drzewo splay moze miec glebokosc liniowa (np. po wstawieniu rosnacych kluczy), dlatego
+    // ponizsze przejscia sa iteracyjne - z jawnym stosem zamiast rekurencji.
+
+    // Odwiedza wezly drzewa w kolejnosci inorder (rosnace klucze).
+    static void for_each_splay(const SplayNode* node, const std::function<void(int, int)>& visit) {
+        std::vector<const SplayNode*> stack;
+        while (node || !stack.empty()) {
+            while (node) {
+                stack.push_back(node);
+                node = node->left;
+            }
+            node = stack.back();
+            stack.pop_back();
+            visit(node->key, node->value);
+            node = node->right;
+        }
+    }
+
+    // Sumuje glebokosci wezlow (porownania przy trafieniu) i pustych dzieci (przy chybieniu);
+    // 'misses' liczy puste dzieci.
+    static void probe_depths_splay(const SplayNode* root, double& hit_total, double& miss_total,
+                                   double& misses, size_t& max_depth) {
+        std::vector<std::pair<const SplayNode*, size_t>> stack{ { root, 0 } };
+        while (!stack.empty()) {
+            const SplayNode* node = stack.back().first;
+            size_t depth = stack.back().second;
+            stack.pop_back();
+            if (!node) {
+                miss_total += static_cast<double>(depth);
+                misses += 1;
+                continue;
+            }
+            hit_total += static_cast<double>(depth + 1);
+            max_depth = std::max(max_depth, depth + 1);
+            stack.emplace_back(node->left, depth + 1);
+            stack.emplace_back(node->right, depth + 1);
+        }
+    }
+
+    // Wyswietla drzewo z wcieciami (prawe poddrzewo u gory): odwrotny inorder.
+    static void display_splay(const SplayNode* node, int depth) {
+        std::vector<std::pair<const SplayNode*, int>> stack;
+        while (node || !stack.empty()) {
+            while (node) {
+                stack.emplace_back(node, depth);
+                node = node->right;
+                ++depth;
+            }
+            node = stack.back().first;
+            depth = stack.back().second;
+            stack.pop_back();
+            for (int i = 0; i < depth; ++i) std::cout << "  ";
+            std::cout << "(" << node->key << "," << node->value << ")" << std::endl;
+            node = node->left;
+            ++depth;
+        }
+    }
+
+    // Alokuje wektor korzeni przy pierwszym wstawieniu (pusta tabela nie zajmuje pamieci).
+    void ensure_allocated() {
+        if (table.empty()) {
+            if (table_size == 0) table_size = 1;
+            table.resize(table_size);
+        }
+    }
+
+    // Zwieksza liczbe kubelkow 'growth_factor' razy i przepina istniejace wezly (bez alokacji),
+    // wiec wskazniki do wartosci pozostaja wazne.
+    void resize() {
+        auto old_table = std::move(table);
+        size_t grown = static_cast<size_t>(std::ceil(table_size * growth_factor));
+        table_size = grown > table_size ? grown : table_size + 1;
+        table.clear();
+        table.resize(table_size);
+        for (const Bucket& bucket : old_table) {
+            if (bucket.generation == generation) {
+                relink_tree(bucket.root);
+            }
+        }
+    }
+
+    // Rozbiera drzewo bez stosu: rotacje w prawo az korzen nie ma lewego dziecka, potem korzen
+    // jest odlaczany i wstawiany do nowego kubelka, a jego prawe poddrzewo staje sie korzeniem.
+    void relink_tree(SplayNode* node) {
+        while (node) {
+            if (node->left) {
+                SplayNode* left = node->left;
+                node->left = left->right;
+                left->right = node;
+                node = left;
+                continue;
+            }
+            SplayNode* next = node->right;
+            node->right = nullptr;
+            SplayNode*& root = root_at(hash_function(node->key, table_size));
+            root = insert_root(splay(root, node->key), node);
+            node = next;
+        }
+    }
+
+public:
+    // Wektor korzeni jest alokowany leniwie - przy pierwszym insert.
+    // Wartosci spoza dozwolonego zakresu sa ignorowane (patrz set_max_load_factor / set_growth_factor).
+    explicit SplayHashTable(size_t initial_size = 16, double max_load_factor = DEFAULT_MAX_LOAD_FACTOR,
+                            double growth_factor = DEFAULT_GROWTH_FACTOR)
+        : table_size(initial_size), current_size(0), generation(1),
+          max_load_factor(DEFAULT_MAX_LOAD_FACTOR), growth_factor(DEFAULT_GROWTH_FACTOR) {
+        set_max_load_factor(max_load_factor);
+        set_growth_factor(growth_factor);
+    }
+
+    bool insert(int key, int value) override {
+        ensure_allocated();
+        if (over_load_factor()) {
+            resize();
+        }
+
+        SplayNode*& root = root_at(hash_function(key, table_size));
+        root = splay(root, key);
+        if (root && root->key == key) {
+            root->value = value; // Klucz juz istnieje - aktualizuj wartosc
+            return true;
+        }
+        root = insert_root(root, arena.create(key, value));
+        current_size++;
+        return true;
+    }
+
+    // Po splay usuwany wezel jest korzeniem; jego lewe poddrzewo po splay z tym samym kluczem
+    // (wiekszym od wszystkich w poddrzewie) ma w korzeniu maksimum bez prawego dziecka,
+    // do ktorego doczepiane jest prawe poddrzewo.
+    bool remove(int key) override {
+        if (table.empty()) return false; // Tabela jeszcze niezaalokowana
+
+        SplayNode*& root = root_at(hash_function(key, table_size));
+        root = splay(root, key);
+        if (!root || root->key != key) {
+            return false;
+        }
+        SplayNode* removed = root;
+        if (!removed->left) {
+            root = removed->right;
+        }
+        else {
+            root = splay(removed->left, key);
+            root->right = removed->right;
+        }
+        arena.destroy(removed);
+        current_size--;
+        return true;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Wyszukanie przenosi znaleziony wezel (lub ostatni na sciezce) do korzenia.
+    // Wezly nie zmieniaja adresu: wskaznik jest wazny do usuniecia tego klucza lub clear.
+    int* find_ptr(int key) override {
+        if (table.empty()) return nullptr; // Tabela jeszcze niezaalokowana
+
+        size_t index = hash_function(key, table_size);
+        if (!live_root(index)) return nullptr; // Pusty kubelek (takze z poprzedniej generacji) - bez zapisu
+        SplayNode*& root = table[index].root;
+        root = splay(root, key);
+        return root && root->key == key ? &root->value : nullptr;
+    }
+
+    // Wersja const to zwykle szukanie w drzewie BST, bez przenoszenia wezla do korzenia.
+    const int* find_ptr(int key) const override {
+        if (table.empty()) return nullptr; // Tabela jeszcze niezaalokowana
+
+        const SplayNode* node = live_root(hash_function(key, table_size));
+        while (node && node->key != key) {
+            node = key < node->key ? node->left : node->right;
+        }
+        return node ? &node->value : nullptr;
+    }
+
+    // Wywoluje 'visit' dla kazdego elementu; w obrebie kubelka w kolejnosci rosnacych kluczy.
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const Bucket& bucket : table) {
+            if (bucket.generation == generation) {
+                for_each_splay(bucket.root, visit);
+            }
+        }
+    }
+
+    void display() override {
+        std::cout << "=== Splay Hash Table ===" << std::endl;
+        for (size_t i = 0; i < table.size(); ++i) {
+            std::cout << "Bucket " << i << ":" << std::endl;
+            if (live_root(i)) {
+                display_splay(live_root(i), 1);
+            }
+            else {
+                std::cout << "  [EMPTY]" << std::endl;
+            }
+        }
+        std::cout << "Total Size: " << current_size << " / Table Capacity: " << table_size << std::endl;
+    }
+
+    size_t size() const override { return current_size; }
+
+    // Obiekt, wektor korzeni i bloki areny (takze wolne sloty).
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(table.capacity() * sizeof(Bucket)) + arena.capacity_bytes();
+    }
+
+    // Glebokosci w biezacym ksztalcie drzew (zmienia sie on przy kazdym dostepie): trafienie -
+    // glebokosc wezla, chybienie - srednia glebokosc pustych dzieci drzewa kubelka.
+    bool probe_stats(ProbeStats& stats) const override {
+        stats = ProbeStats();
+        if (table.empty()) return true;
+        double hit_total = 0;
+        double miss_total = 0;
+        for (const Bucket& bucket : table) {
+            if (bucket.generation != generation || !bucket.root) continue;
+            double bucket_miss = 0;
+            double bucket_externals = 0;
+            probe_depths_splay(bucket.root, hit_total, bucket_miss, bucket_externals, stats.max_hit);
+            miss_total += bucket_miss / bucket_externals;
+        }
+        stats.average_hit = current_size ? hit_total / static_cast<double>(current_size) : 0.0;
+        stats.average_miss = miss_total / static_cast<double>(table_size);
+        return true;
+    }
+
+    // Dozwolony zakres: (0, LOAD_FACTOR_LIMIT].
+    bool set_max_load_factor(double value) override {
+        if (!(value > 0.0 && value <= LOAD_FACTOR_LIMIT)) return false;
+        max_load_factor = value;
+        while (!table.empty() && over_load_factor()) {
+            resize();
+        }
+        return true;
+    }
+
+    // Dozwolony zakres: (1, GROWTH_FACTOR_LIMIT].
+    bool set_growth_factor(double value) override {
+        if (!(value > 1.0 && value <= GROWTH_FACTOR_LIMIT)) return false;
+        growth_factor = value;
+        return true;
+    }
+
+    double get_max_load_factor() const override { return max_load_factor; }
+
+    double get_growth_factor() const override { return growth_factor; }
+
+    // Czysci tabele w czasie O(1): wezly wracaja naraz do areny, a nowa generacja
+    // sprawia, ze stare korzenie czytaja sie jako puste.
+    void clear() override {
+        clear(false);
+    }
+
+    // Przy 'release_storage' zwalnia tez pamiec areny i wektor korzeni.
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            arena.release();
+            std::vector<Bucket>().swap(table);
+        }
+        else {
+            arena.reset();
+            if (++generation == 0) {
+                // Licznik generacji sie przekrecil - wyzeruj korzenie naprawde
+                for (Bucket& bucket : table) {
+                    bucket = Bucket();
+                }
+                generation = 1;
+            }
+        }
+        current_size = 0;
+    }
+
+    std::string get_name() const override {
+        return "Splay Hash Table";
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h).
+inline const bool splay_hash_table_registered = register_engine({
+    "splay", "Drzewa splay", "Splay", 32, 40.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new SplayHashTable(n)); } });
+
+#endif // SPLAY_HASH_TABLE_H
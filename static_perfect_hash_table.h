@@ -0,0 +1,303 @@
+#ifndef STATIC_PERFECT_HASH_TABLE_H
+#define STATIC_PERFECT_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "cpu_dispatch.h"    // Hashowanie wszystkich kluczy naraz przy budowie (mix_hash_batch)
+#include <algorithm> // std::sort dla kolejnosci przetwarzania kubelkow
+#include <cstdint>   // uint16_t / uint32_t dla pilotow i tablicy przemapowan
+#include <unordered_map> // Usuwanie duplikatow kluczy przy budowie
+#include <utility>   // std::pair
+
+// Implementacja 4: Statyczna tabela z minimalna funkcja hashujaca doskonala (styl PTHash).
+// Tabela jest budowana raz dla ustalonego zbioru kluczy i pozniej nie zmienia tego zbioru.
+// Kazdy klucz ma wlasny slot w gestej tablicy n elementow, wiec find to obliczenie hasha,
+// odczyt 16-bitowego pilota kubelka (mala tablica, zwykle w cache) i jeden dostep do slotu
+// - bez probkowania i bez lancuchow.
+//
+// Budowa:
+// 1. Klucze sa dzielone na n / KEYS_PER_BUCKET kubelkow funkcja mix_hash(key, seed),
+//    z rozkladem skosnym: 60% kluczy trafia do 30% kubelkow ("gestych"), dzieki czemu
+//    duze kubelki sa umieszczane, gdy tablica jest jeszcze prawie pusta.
+// 2. Kubelki sa przetwarzane od najwiekszego; dla kazdego szukany jest pilot, przy ktorym
+//    pozycje wszystkich jego kluczy w tablicy pomocniczej m = n / ALPHA slotow sa wolne.
+// 3. Pozycje >= n sa przemapowywane na wolne sloty < n, dzieki czemu tablica wartosci
+//    jest gesta (funkcja minimalna). Pilot 16-bitowy na 5 kluczy daje ok. 3.2 bita/klucz.
+//
+// Interfejs HashTableBase jest zachowany: insert aktualizuje wartosc istniejacego klucza,
+// ale nie dodaje nowych (zwraca false), a remove zawsze zwraca false.
+class StaticPerfectHashTable : public HashTableBase {
+private:
+    struct KeyValue {
+        int key;
+        int value;
+    };
+
+    std::vector<KeyValue> slots;      // Gesta tablica n par klucz-wartosc
+    std::vector<uint16_t> pilots;     // Pilot dla kazdego kubelka
+    std::vector<uint32_t> remap;      // Przemapowanie pozycji [n, m) na wolne sloty < n
+    size_t bucket_count = 0;          // Liczba kubelkow
+    size_t dense_bucket_count = 0;    // Liczba kubelkow "gestych" (poczatek tablicy pilotow)
+    size_t position_range = 0;        // m - zakres pozycji przed przemapowaniem
+    unsigned int seed = 0;            // Ziarno funkcji hashujacych
+
+    // Srednia liczba kluczy na kubelek (kompromis miedzy pamiecia a czasem budowy).
+    static constexpr size_t KEYS_PER_BUCKET = 5;
+    // Wypelnienie tablicy pomocniczej; ALPHA < 1 pozwala znalezc piloty dla ostatnich kubelkow.
+    static constexpr double ALPHA = 0.99;
+    // Liczba ziaren probowanych dla jednego wypelnienia; potem wypelnienie jest zmniejszane
+    // o ALPHA_STEP (wiecej wolnych pozycji), az do MIN_ALPHA.
+    static constexpr unsigned int MAX_SEED_ATTEMPTS = 64;
+    static constexpr double ALPHA_STEP = 0.1;
+    static constexpr double MIN_ALPHA = 0.5;
+    // Maksymalna wartosc pilota; po jej przekroczeniu budowa startuje od nowa z innym ziarnem.
+    static constexpr uint32_t MAX_PILOT = 0xFFFF;
+    // Prog hasha dla kubelkow gestych (60% zakresu unsigned int).
+    static constexpr unsigned int DENSE_HASH_THRESHOLD = 0x99999999u;
+
+    // Kubelek klucza: 60% przestrzeni hasha trafia do pierwszych 30% kubelkow.
+    size_t bucket_of(int key) const {
+        return bucket_of_hash(mix_hash(key, seed));
+    }
+
+    // Kubelek dla gotowego hasha h = mix_hash(key, seed).
+    size_t bucket_of_hash(unsigned int h) const {
+        if (h < DENSE_HASH_THRESHOLD) {
+            return h % dense_bucket_count;
+        }
+        return dense_bucket_count + h % (bucket_count - dense_bucket_count);
+    }
+
+    // Pozycja klucza w zakresie [0, m) dla danego pilota; 'key_hash' = mix_hash(key, seed + 1).
+    size_t position_of(unsigned int key_hash, uint32_t pilot) const {
+        unsigned int mixed = key_hash ^ mix_hash(static_cast<int>(pilot), seed + 2);
+        return static_cast<size_t>(mix_hash(static_cast<int>(mixed))) % position_range;
+    }
+
+    // Indeks slotu klucza w gestej tablicy (dla kluczy spoza zbioru - dowolny slot).
+    size_t slot_of(int key) const {
+        size_t position = position_of(mix_hash(key, seed + 1), pilots[bucket_of(key)]);
+        return position < slots.size() ? position : remap[position - slots.size()];
+    }
+
+    // Probuje zbudowac funkcje dla biezacego ziarna i wypelnienia 'alpha'. Zwraca false,
+    // jesli dla ktoregos kubelka nie udalo sie znalezc pilota.
+    // 'keys' to klucze z 'entries' w tej samej kolejnosci (ciagle - dla hashowania SIMD).
+    bool try_build(const std::vector<KeyValue>& entries, const std::vector<int>& keys, double alpha) {
+        size_t n = entries.size();
+        bucket_count = (n + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET;
+        dense_bucket_count = std::max<size_t>(1, bucket_count * 3 / 10);
+        if (bucket_count < 2) {
+            bucket_count = 2; // Co najmniej jeden kubelek gesty i jeden rzadki
+        }
+        position_range = std::max(n, static_cast<size_t>(n / alpha));
+        pilots.assign(bucket_count, 0);
+
+        // Podziel klucze na kubelki i zapamietaj ich hashe pozycji (niezalezne od pilota).
+        // Oba hashe sa liczone dla wszystkich kluczy naraz jadrem SIMD.
+        std::vector<unsigned int> bucket_hashes(n);
+        std::vector<unsigned int> key_hashes(n);
+        mix_hash_batch(keys.data(), n, seed, bucket_hashes.data());
+        mix_hash_batch(keys.data(), n, seed + 1, key_hashes.data());
+        std::vector<std::vector<size_t>> buckets(bucket_count);
+        for (size_t i = 0; i < n; ++i) {
+            buckets[bucket_of_hash(bucket_hashes[i])].push_back(i);
+        }
+
+        // Kubelki od najwiekszego - najtrudniejsze do umieszczenia, gdy tablica jest jeszcze pusta
+        std::vector<size_t> order(bucket_count);
+        for (size_t b = 0; b < bucket_count; ++b) order[b] = b;
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::vector<bool> taken(position_range, false);
+        std::vector<int> position_owner(position_range, -1); // Indeks wpisu na danej pozycji
+        std::vector<size_t> positions;
+
+        for (size_t b : order) {
+            const auto& bucket = buckets[b];
+            if (bucket.empty()) break; // Pozostale kubelki tez sa puste
+
+            bool placed = false;
+            for (uint32_t pilot = 0; pilot <= MAX_PILOT && !placed; ++pilot) {
+                positions.clear();
+                placed = true;
+                for (size_t entry_idx : bucket) {
+                    size_t position = position_of(key_hashes[entry_idx], pilot);
+                    // Pozycja zajeta przez inny kubelek lub kolizja w obrebie kubelka
+                    if (taken[position] ||
+                        std::find(positions.begin(), positions.end(), position) != positions.end()) {
+                        placed = false;
+                        break;
+                    }
+                    positions.push_back(position);
+                }
+                if (placed) {
+                    pilots[b] = static_cast<uint16_t>(pilot);
+                    for (size_t i = 0; i < bucket.size(); ++i) {
+                        taken[positions[i]] = true;
+                        position_owner[positions[i]] = static_cast<int>(bucket[i]);
+                    }
+                }
+            }
+            if (!placed) return false;
+        }
+
+        // Przemapuj pozycje [n, m) na wolne sloty < n i rozloz wartosci w gestej tablicy
+        slots.assign(n, KeyValue{ 0, 0 });
+        remap.assign(position_range - n, 0);
+        size_t next_free = 0;
+        for (size_t position = 0; position < position_range; ++position) {
+            if (position_owner[position] < 0) continue;
+            size_t slot = position;
+            if (position >= n) {
+                while (taken[next_free]) ++next_free; // Pierwszy wolny slot < n
+                taken[next_free] = true;
+                slot = next_free;
+                remap[position - n] = static_cast<uint32_t>(slot);
+            }
+            slots[slot] = entries[position_owner[position]];
+        }
+        return true;
+    }
+
+public:
+    // Buduje tabele dla podanych par klucz-wartosc. Przy powtorzonym kluczu obowiazuje ostatnia wartosc.
+    explicit StaticPerfectHashTable(const std::vector<std::pair<int, int>>& entries = {}) {
+        build(entries);
+    }
+
+    // (Prze)buduje funkcje hashujaca dla nowego zbioru kluczy. Zwraca false (tabela zostaje
+    // pusta), jesli zadne ziarno nie dalo funkcji przy zadnym dozwolonym wypelnieniu.
+    bool build(const std::vector<std::pair<int, int>>& entries) {
+        // Usun duplikaty kluczy, zachowujac ostatnia wartosc
+        std::unordered_map<int, size_t> index_of;
+        std::vector<KeyValue> unique_entries;
+        unique_entries.reserve(entries.size());
+        for (const auto& entry : entries) {
+            auto it = index_of.find(entry.first);
+            if (it != index_of.end()) {
+                unique_entries[it->second].value = entry.second;
+            }
+            else {
+                index_of.emplace(entry.first, unique_entries.size());
+                unique_entries.push_back(KeyValue{ entry.first, entry.second });
+            }
+        }
+
+        clear();
+        if (unique_entries.empty()) return true;
+
+        std::vector<int> keys(unique_entries.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            keys[i] = unique_entries[i].key;
+        }
+
+        // Nieudana proba (brak pilota dla kubelka) - zmien ziarno i sprobuj ponownie; po
+        // MAX_SEED_ATTEMPTS probach zmniejsz wypelnienie, aby patologiczny zbior nie zawiesil budowy
+        for (double alpha = ALPHA; alpha >= MIN_ALPHA; alpha -= ALPHA_STEP) {
+            seed = 1;
+            for (unsigned int attempt = 0; attempt < MAX_SEED_ATTEMPTS; ++attempt, seed += 3) {
+                if (try_build(unique_entries, keys, alpha)) {
+                    return true;
+                }
+            }
+        }
+        clear();
+        return false;
+    }
+
+    // Aktualizuje wartosc istniejacego klucza. Nowych kluczy nie mozna dodac
+    // (zbior kluczy jest staly) - wtedy zwraca false; uzyj build(), aby zmienic zbior.
+    bool insert(int key, int value) override {
+        int* found = find_ptr(key);
+        if (found) {
+            *found = value;
+            return true;
+        }
+        return false;
+    }
+
+    // Tabela statyczna nie wspiera usuwania pojedynczych kluczy.
+    bool remove(int /*key*/) override {
+        return false;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Zwraca wskaznik do wartosci w gestej tablicy lub nullptr.
+    // Sloty sa stabilne az do kolejnego build() lub clear().
+    const int* find_ptr(int key) const override {
+        if (slots.empty()) return nullptr;
+        const KeyValue& slot = slots[slot_of(key)];
+        return slot.key == key ? &slot.value : nullptr;
+    }
+
+    int* find_ptr(int key) override {
+        return const_cast<int*>(static_cast<const StaticPerfectHashTable*>(this)->find_ptr(key));
+    }
+
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const auto& slot : slots) {
+            visit(slot.key, slot.value);
+        }
+    }
+
+    // Wyswietla zawartosc tabeli hashujacej.
+    void display() override {
+        std::cout << "=== Static Perfect Hash Table ===" << std::endl;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            std::cout << "Slot " << i << ": (" << slots[i].key << "," << slots[i].value << ")" << std::endl;
+        }
+        std::cout << "Size: " << slots.size() << ", buckets: " << bucket_count
+                  << ", bits/key: " << bits_per_key() << std::endl;
+    }
+
+    size_t size() const override { return slots.size(); }
+
+    // Obiekt, sloty, piloty i tablica przemapowania (bez pamieci tymczasowej budowy).
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(slots.capacity() * sizeof(KeyValue)) +
+               heap_block_bytes(pilots.capacity() * sizeof(uint16_t)) +
+               heap_block_bytes(remap.capacity() * sizeof(uint32_t));
+    }
+
+    // Usuwa wszystkie elementy (pusty zbior kluczy).
+    void clear() override {
+        clear(false);
+    }
+
+    void clear(bool release_storage) override {
+        slots.clear();
+        pilots.clear();
+        remap.clear();
+        if (release_storage) {
+            slots.shrink_to_fit();
+            pilots.shrink_to_fit();
+            remap.shrink_to_fit();
+        }
+        bucket_count = 0;
+        dense_bucket_count = 0;
+        position_range = 0;
+    }
+
+    // Narzut funkcji hashujacej (piloty i przemapowania) w bitach na klucz.
+    double bits_per_key() const {
+        if (slots.empty()) return 0.0;
+        double bits = pilots.size() * 16.0 + remap.size() * 32.0;
+        return bits / slots.size();
+    }
+
+    std::string get_name() const override {
+        return "Static Perfect Hash Table";
+    }
+};
+
+#endif // STATIC_PERFECT_HASH_TABLE_H
@@ -0,0 +1,422 @@
+#ifndef STD_ADAPTERS_H
+#define STD_ADAPTERS_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "cpu_dispatch.h"    // find_int - przeszukiwanie bufora wstawien
+#include "engine_registry.h" // Rejestracja w benchmarkach i demonstracji
+#include <algorithm>     // std::lower_bound, std::sort
+#include <cmath>         // std::sqrt
+#include <cstdint>       // uint8_t dla znacznikow usuniecia
+#include <map>           // std::map
+#include <unordered_map> // std::unordered_map
+
+// Adaptery kontenerow biblioteki standardowej do interfejsu HashTableBase.
+// Sluza jako punkt odniesienia w benchmarkach: wyniki wlasnych implementacji
+// sa raportowane jako przyspieszenie lub spowolnienie wzgledem nich.
+
+// std::unordered_map (kubki z listami wezlow). Wskazniki z find_ptr sa stabilne
+// az do usuniecia klucza - rehash nie przenosi wezlow.
+class StdUnorderedMapTable : public HashTableBase {
+private:
+    std::unordered_map<int, int> map;
+
+public:
+    // Rezerwuje miejsce na 'initial_size' elementow (jak pojemnosc poczatkowa pozostalych tabel).
+    explicit StdUnorderedMapTable(size_t initial_size = 16) {
+        map.reserve(initial_size);
+    }
+
+    bool insert(int key, int value) override {
+        map[key] = value;
+        return true;
+    }
+
+    bool remove(int key) override {
+        return map.erase(key) > 0;
+    }
+
+    bool find(int key, int& value) override {
+        auto it = map.find(key);
+        if (it == map.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    const int* find_ptr(int key) const override {
+        auto it = map.find(key);
+        return it == map.end() ? nullptr : &it->second;
+    }
+
+    int* find_ptr(int key) override {
+        auto it = map.find(key);
+        return it == map.end() ? nullptr : &it->second;
+    }
+
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const auto& kv : map) {
+            visit(kv.first, kv.second);
+        }
+    }
+
+    void display() override {
+        std::cout << "=== " << get_name() << " ===" << std::endl;
+        for (const auto& kv : map) {
+            std::cout << "(" << kv.first << "," << kv.second << ") ";
+        }
+        std::cout << std::endl << "Size: " << map.size() << ", buckets: " << map.bucket_count() << std::endl;
+    }
+
+    size_t size() const override { return map.size(); }
+
+    // Szacunek dla libstdc++: tablica wskaznikow kubkow i wezly (wskaznik nastepnika i para;
+    // hash klucza int nie jest przechowywany), kazdy osobno zaalokowany.
+    size_t memory_usage() const override {
+        size_t node = sizeof(void*) + sizeof(std::pair<const int, int>);
+        return sizeof(*this) + heap_block_bytes(map.bucket_count() * sizeof(void*)) +
+               map.size() * heap_block_bytes(node);
+    }
+
+    // Przekazywane do std::unordered_map::max_load_factor (dowolna wartosc > 0). Krotnosci
+    // wzrostu biblioteka nie udostepnia - set_growth_factor pozostaje nieobslugiwane.
+    bool set_max_load_factor(double value) override {
+        if (!(value > 0.0)) return false;
+        map.max_load_factor(static_cast<float>(value));
+        if (map.load_factor() > map.max_load_factor()) {
+            map.rehash(0); // libstdc++ zmienia liczbe kubkow dopiero przy nastepnym wstawieniu
+        }
+        return true;
+    }
+
+    double get_max_load_factor() const override { return map.max_load_factor(); }
+
+    // Wezly listy kubka porownane przy szukaniu (jak w tabeli z lancuchowaniem).
+    bool probe_stats(ProbeStats& stats) const override {
+        stats = ProbeStats();
+        double hit_total = 0;
+        for (size_t bucket = 0; bucket < map.bucket_count(); ++bucket) {
+            size_t length = map.bucket_size(bucket);
+            hit_total += static_cast<double>(length) * static_cast<double>(length + 1) / 2;
+            stats.max_hit = std::max(stats.max_hit, length);
+        }
+        stats.average_hit = map.empty() ? 0.0 : hit_total / static_cast<double>(map.size());
+        stats.average_miss = static_cast<double>(map.size()) / static_cast<double>(map.bucket_count());
+        return true;
+    }
+
+    void clear() override {
+        map.clear(); // Tablica kubkow zostaje
+    }
+
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            std::unordered_map<int, int>().swap(map);
+        }
+        else {
+            map.clear();
+        }
+    }
+
+    std::string get_name() const override {
+        return "std::unordered_map";
+    }
+};
+
+// std::map (drzewo czerwono-czarne). Wskazniki z find_ptr sa stabilne az do usuniecia klucza.
+class StdMapTable : public HashTableBase {
+private:
+    std::map<int, int> map;
+
+public:
+    // Drzewo nie ma pojemnosci poczatkowej - parametr jest tylko dla zgodnosci z innymi tabelami.
+    explicit StdMapTable(size_t /*initial_size*/ = 16) {}
+
+    bool insert(int key, int value) override {
+        map[key] = value;
+        return true;
+    }
+
+    bool remove(int key) override {
+        return map.erase(key) > 0;
+    }
+
+    bool find(int key, int& value) override {
+        auto it = map.find(key);
+        if (it == map.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    const int* find_ptr(int key) const override {
+        auto it = map.find(key);
+        return it == map.end() ? nullptr : &it->second;
+    }
+
+    int* find_ptr(int key) override {
+        auto it = map.find(key);
+        return it == map.end() ? nullptr : &it->second;
+    }
+
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const auto& kv : map) {
+            visit(kv.first, kv.second);
+        }
+    }
+
+    void display() override {
+        std::cout << "=== " << get_name() << " ===" << std::endl;
+        for (const auto& kv : map) {
+            std::cout << "(" << kv.first << "," << kv.second << ") ";
+        }
+        std::cout << std::endl << "Size: " << map.size() << std::endl;
+    }
+
+    size_t size() const override { return map.size(); }
+
+    // Szacunek dla libstdc++: osobno alokowany wezel na element (kolor, trzy wskazniki i para).
+    size_t memory_usage() const override {
+        size_t node = sizeof(int) + 3 * sizeof(void*) + sizeof(std::pair<const int, int>);
+        return sizeof(*this) + map.size() * heap_block_bytes(node);
+    }
+
+    void clear() override {
+        map.clear(); // Wezly drzewa sa zwalniane zawsze
+    }
+
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            std::map<int, int>().swap(map);
+        }
+        else {
+            map.clear();
+        }
+    }
+
+    std::string get_name() const override {
+        return "std::map";
+    }
+};
+
+// Posortowany wektor z wyszukiwaniem binarnym (jak flat_map).
+// Czysty posortowany wektor ma insert i remove O(n) - przy losowych kluczach benchmark
+// trwalby godzinami. Dlatego nowe klucze trafiaja najpierw do malego, nieposortowanego
+// bufora (przeszukiwanego SIMD), ktory po zapelnieniu jest sortowany i scalany z glowna
+// tablica w O(n); usuwanie tylko oznacza element, a oznaczone sa wyrzucane przy scaleniu.
+// Rozmiar bufora ~ sqrt(n) daje zamortyzowany koszt wstawienia O(sqrt(n)).
+class SortedVectorTable : public HashTableBase {
+private:
+    std::vector<int> keys;       // Posortowane klucze glownej tablicy (osobno - dla wyszukiwania binarnego)
+    std::vector<int> values;     // Wartosci odpowiadajace kluczom
+    std::vector<uint8_t> erased; // 1 = element usuniety (do wyrzucenia przy scaleniu)
+    size_t erased_count;
+    std::vector<int> buffer_keys;   // Nowe klucze spoza glownej tablicy, nieposortowane
+    std::vector<int> buffer_values;
+    size_t current_size;
+
+    static constexpr size_t MIN_BUFFER = 64;
+
+    // Pozycja klucza w glownej tablicy lub keys.size().
+    size_t find_in_main(int key) const {
+        auto it = std::lower_bound(keys.begin(), keys.end(), key);
+        return it != keys.end() && *it == key ? static_cast<size_t>(it - keys.begin()) : keys.size();
+    }
+
+    size_t buffer_limit() const {
+        return std::max(MIN_BUFFER, static_cast<size_t>(std::sqrt(static_cast<double>(keys.size()))));
+    }
+
+    // Sortuje bufor i scala go z glowna tablica, pomijajac usuniete elementy.
+    void merge() {
+        std::vector<std::pair<int, int>> pending(buffer_keys.size());
+        for (size_t i = 0; i < buffer_keys.size(); ++i) {
+            pending[i] = { buffer_keys[i], buffer_values[i] };
+        }
+        std::sort(pending.begin(), pending.end());
+
+        std::vector<int> merged_keys;
+        std::vector<int> merged_values;
+        merged_keys.reserve(current_size);
+        merged_values.reserve(current_size);
+        size_t i = 0;
+        size_t j = 0;
+        while (i < keys.size() || j < pending.size()) {
+            if (i < keys.size() && erased[i]) {
+                ++i;
+            }
+            else if (j == pending.size() || (i < keys.size() && keys[i] < pending[j].first)) {
+                merged_keys.push_back(keys[i]);
+                merged_values.push_back(values[i]);
+                ++i;
+            }
+            else {
+                merged_keys.push_back(pending[j].first);
+                merged_values.push_back(pending[j].second);
+                ++j;
+            }
+        }
+        keys.swap(merged_keys);
+        values.swap(merged_values);
+        erased.assign(keys.size(), 0);
+        erased_count = 0;
+        buffer_keys.clear();
+        buffer_values.clear();
+    }
+
+public:
+    explicit SortedVectorTable(size_t initial_size = 16)
+        : erased_count(0), current_size(0) {
+        keys.reserve(initial_size);
+        values.reserve(initial_size);
+    }
+
+    bool insert(int key, int value) override {
+        size_t pos = find_in_main(key);
+        if (pos < keys.size()) {
+            if (erased[pos]) {
+                erased[pos] = 0; // Klucz wraca na swoje miejsce
+                erased_count--;
+                current_size++;
+            }
+            values[pos] = value;
+            return true;
+        }
+
+        size_t index = find_int(buffer_keys.data(), buffer_keys.size(), key);
+        if (index < buffer_keys.size()) {
+            buffer_values[index] = value;
+            return true;
+        }
+
+        buffer_keys.push_back(key);
+        buffer_values.push_back(value);
+        current_size++;
+        if (buffer_keys.size() >= buffer_limit()) {
+            merge();
+        }
+        return true;
+    }
+
+    bool remove(int key) override {
+        size_t pos = find_in_main(key);
+        if (pos < keys.size()) {
+            if (erased[pos]) {
+                return false;
+            }
+            erased[pos] = 1;
+            erased_count++;
+            current_size--;
+            if (erased_count > keys.size() / 2) {
+                merge(); // Wiecej niz polowa tablicy to usuniete elementy - zwolnij je
+            }
+            return true;
+        }
+
+        size_t index = find_int(buffer_keys.data(), buffer_keys.size(), key);
+        if (index == buffer_keys.size()) {
+            return false;
+        }
+        buffer_keys[index] = buffer_keys.back(); // Kolejnosc bufora nie ma znaczenia
+        buffer_values[index] = buffer_values.back();
+        buffer_keys.pop_back();
+        buffer_values.pop_back();
+        current_size--;
+        return true;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Wskaznik jest wazny do najblizszego insert lub remove (scalenie przenosi elementy).
+    const int* find_ptr(int key) const override {
+        size_t pos = find_in_main(key);
+        if (pos < keys.size()) {
+            return erased[pos] ? nullptr : &values[pos];
+        }
+        size_t index = find_int(buffer_keys.data(), buffer_keys.size(), key);
+        return index < buffer_keys.size() ? &buffer_values[index] : nullptr;
+    }
+
+    int* find_ptr(int key) override {
+        return const_cast<int*>(static_cast<const SortedVectorTable*>(this)->find_ptr(key));
+    }
+
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (!erased[i]) visit(keys[i], values[i]);
+        }
+        for (size_t i = 0; i < buffer_keys.size(); ++i) {
+            visit(buffer_keys[i], buffer_values[i]);
+        }
+    }
+
+    void display() override {
+        std::cout << "=== " << get_name() << " ===" << std::endl;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (!erased[i]) std::cout << "(" << keys[i] << "," << values[i] << ") ";
+        }
+        std::cout << std::endl << "Insert buffer: ";
+        for (size_t i = 0; i < buffer_keys.size(); ++i) {
+            std::cout << "(" << buffer_keys[i] << "," << buffer_values[i] << ") ";
+        }
+        std::cout << std::endl << "Size: " << current_size << std::endl;
+    }
+
+    size_t size() const override { return current_size; }
+
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(keys.capacity() * sizeof(int)) +
+               heap_block_bytes(values.capacity() * sizeof(int)) + heap_block_bytes(erased.capacity()) +
+               heap_block_bytes(buffer_keys.capacity() * sizeof(int)) +
+               heap_block_bytes(buffer_values.capacity() * sizeof(int));
+    }
+
+    void clear() override {
+        clear(false);
+    }
+
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            std::vector<int>().swap(keys);
+            std::vector<int>().swap(values);
+            std::vector<uint8_t>().swap(erased);
+            std::vector<int>().swap(buffer_keys);
+            std::vector<int>().swap(buffer_values);
+        }
+        else {
+            keys.clear();
+            values.clear();
+            erased.clear();
+            buffer_keys.clear();
+            buffer_values.clear();
+        }
+        erased_count = 0;
+        current_size = 0;
+    }
+
+    std::string get_name() const override {
+        return "Sorted Vector (binary search)";
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h). Kontenery standardowe sa oznaczone
+// jako punkt odniesienia - wzgledem nich liczone jest przyspieszenie pozostalych silnikow.
+inline const bool std_unordered_map_table_registered = register_engine({
+    "std-unordered-map", "std::unordered_map", "std::unordered_map", 100, 40.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new StdUnorderedMapTable(n)); }, true });
+inline const bool std_map_table_registered = register_engine({
+    "std-map", "std::map", "std::map", 110, 48.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new StdMapTable(n)); }, true });
+inline const bool sorted_vector_table_registered = register_engine({
+    "sorted-vector", "Posortowany wektor", "Sorted Vector", 120, 10.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new SortedVectorTable(n)); } });
+
+#endif // STD_ADAPTERS_H
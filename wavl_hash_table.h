@@ -0,0 +1,576 @@
+#ifndef WAVL_HASH_TABLE_H
+#define WAVL_HASH_TABLE_H
+
+#include "hash_table_base.h" // Dolacza bazowa klase dla tabeli hashujacej
+#include "node_arena.h"      // Pula wezlow z szybkim zwalnianiem wszystkich naraz
+#include "engine_registry.h" // Rejestracja w benchmarkach i demonstracji
+#include <algorithm> // std::max
+#include <cmath>     // std::ceil - nowy rozmiar przy wzroscie
+#include <cstdint>   // uint32_t dla licznika generacji, uintptr_t dla znacznikow we wskaznikach
+
+// Hash Table z kubelkami zawierajacymi drzewa weak AVL (WAVL; Haeupler, Sen, Tarjan).
+// Kazdy wezel ma range; roznica rang rodzica i dziecka wynosi 1 lub 2 (brakujace dziecko ma
+// range -1), a lisc ma range 0. Bez usuniec drzewo jest drzewem AVL; usuniecia dopuszczaja
+// wezly (2,2), dzieki czemu rebalansowanie konczy sie po co najwyzej dwoch rotacjach na
+// operacje (zamortyzowane O(1) zmian rang), podczas gdy usuniecie w AVL moze rotowac na kazdym
+// poziomie sciezki. Range nie sa przechowywane: wystarcza dwie roznice rang dzieci, po jednym
+// bicie w najmlodszym bicie wskaznika na dziecko (wezly sa wyrownane do 8 B), wiec wezel ma
+// 24 B zamiast 32 B w AVLHashTable i nie ma wysokosci liczonej przez std::max na kazdym poziomie.
+class WAVLHashTable : public HashTableBase {
+private:
+    struct WAVLNode;
+
+    // Wskaznik na dziecko z roznica rang (1 lub 2) w najmlodszym bicie.
+    class ChildLink {
+        uintptr_t bits = 0;
+
+    public:
+        WAVLNode* node() const { return reinterpret_cast<WAVLNode*>(bits & ~uintptr_t{ 1 }); }
+        bool two() const { return bits & 1; } // Roznica rang 2 (inaczej 1)
+        void set(WAVLNode* child, bool two) { bits = reinterpret_cast<uintptr_t>(child) | (two ? 1 : 0); }
+        void set_node(WAVLNode* child) { bits = reinterpret_cast<uintptr_t>(child) | (bits & 1); }
+        void set_two(bool two) { bits = (bits & ~uintptr_t{ 1 }) | (two ? 1 : 0); }
+    };
+
+    struct WAVLNode {
+        int key;
+        int value;
+        ChildLink left;  // Roznice rang 1 i 1 - nowy lisc (range 0)
+        ChildLink right;
+
+        WAVLNode(int k, int v) : key(k), value(v) {}
+    };
+
+    // Kubelek: korzen drzewa i generacja tabeli, w ktorej zostal zapisany.
+    // Korzen z innej generacji jest traktowany jako pusty (nullptr).
+    struct Bucket {
+        WAVLNode* root = nullptr;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Bucket> table;  // Wektor korzeni drzew WAVL
+    size_t table_size;          // Liczba kubelkow
+    size_t current_size;        // Liczba elementow we wszystkich drzewach
+    uint32_t generation;        // Biezaca generacja tabeli (zwiekszana przez clear)
+    NodeArena<WAVLNode> arena;  // Pula, z ktorej pochodza wszystkie wezly tabeli
+    double max_load_factor;     // Wspolczynnik wypelnienia, po przekroczeniu ktorego tabela rosnie
+    double growth_factor;       // Krotnosc wzrostu liczby kubelkow przy resize()
+    uint64_t rotations = 0;     // Rotacje od utworzenia tabeli (podwojna liczona jako 2)
+
+    static constexpr double DEFAULT_MAX_LOAD_FACTOR = 1.0;
+    static constexpr double LOAD_FACTOR_LIMIT = 64.0; // Gorna granica (sredni rozmiar drzewa)
+    static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
+    static constexpr double GROWTH_FACTOR_LIMIT = 4.0;
+
+    // Zwraca referencje do korzenia kubelka, zerujac go najpierw, jesli pochodzi z poprzedniej generacji.
+    WAVLNode*& root_at(size_t index) {
+        Bucket& bucket = table[index];
+        if (bucket.generation != generation) {
+            bucket.root = nullptr;
+            bucket.generation = generation;
+        }
+        return bucket.root;
+    }
+
+    // Korzen kubelka bez modyfikacji tabeli: kubelek z poprzedniej generacji jest pusty.
+    WAVLNode* live_root(size_t index) const {
+        const Bucket& bucket = table[index];
+        return bucket.generation == generation ? bucket.root : nullptr;
+    }
+
+    bool over_load_factor() const {
+        return static_cast<double>(current_size) / table_size > max_load_factor;
+    }
+
+    // --- Rebalansowanie po wstawieniu: range lewego (prawego) dziecka wzrosla o 1 ---
+    // 'grew' na wyjsciu: czy wzrosla ranga zwracanego poddrzewa (kontynuacja w gore).
+
+    WAVLNode* grown_left(WAVLNode* x, bool& grew) {
+        if (x->left.two()) { // Roznica 2 -> 1
+            x->left.set_two(false);
+            grew = false;
+            return x;
+        }
+        if (!x->right.two()) { // (0,1): promocja x
+            x->right.set_two(true);
+            grew = true;
+            return x;
+        }
+        // (0,2): rotacja; dziecko 'y' wlasnie awansowalo, wiec jest (1,2) lub (2,1)
+        grew = false;
+        WAVLNode* y = x->left.node();
+        if (y->right.two()) { // Zewnetrzny wnuk jest 1-dzieckiem: pojedyncza rotacja, x traci range
+            x->left.set(y->right.node(), false);
+            x->right.set_two(false);
+            y->right.set(x, false);
+            rotations += 1;
+            return y;
+        }
+        // Wewnetrzny wnuk z zostaje korzeniem, x i y traca range
+        WAVLNode* z = y->right.node();
+        y->right.set(z->left.node(), z->left.two());
+        y->left.set_two(false);
+        x->left.set(z->right.node(), z->right.two());
+        x->right.set_two(false);
+        z->left.set(y, false);
+        z->right.set(x, false);
+        rotations += 2;
+        return z;
+    }
+
+    WAVLNode* grown_right(WAVLNode* x, bool& grew) {
+        if (x->right.two()) {
+            x->right.set_two(false);
+            grew = false;
+            return x;
+        }
+        if (!x->left.two()) {
+            x->left.set_two(true);
+            grew = true;
+            return x;
+        }
+        grew = false;
+        WAVLNode* y = x->right.node();
+        if (y->left.two()) {
+            x->right.set(y->left.node(), false);
+            x->left.set_two(false);
+            y->left.set(x, false);
+            rotations += 1;
+            return y;
+        }
+        WAVLNode* z = y->left.node();
+        y->left.set(z->right.node(), z->right.two());
+        y->right.set_two(false);
+        x->right.set(z->left.node(), z->left.two());
+        x->left.set_two(false);
+        z->right.set(y, false);
+        z->left.set(x, false);
+        rotations += 2;
+        return z;
+    }
+
+    // --- Rebalansowanie po usunieciu: ranga lewego (prawego) dziecka spadla o 1 ---
+    // 'shrunk' na wyjsciu: czy spadla ranga zwracanego poddrzewa (kontynuacja w gore).
+
+    WAVLNode* shrunk_left(WAVLNode* x, bool& shrunk) {
+        if (!x->left.two()) { // Roznica 1 -> 2
+            x->left.set_two(true);
+            shrunk = !x->left.node() && !x->right.node(); // Lisc (2,2) ma range 1 - degradacja do 0
+            if (shrunk) {
+                x->left.set_two(false);
+                x->right.set_two(false);
+            }
+            return x;
+        }
+        // Roznica 3 (bit 'two' oznacza teraz 3); ranga x >= 2, wiec prawe dziecko istnieje
+        WAVLNode* y = x->right.node();
+        if (x->right.two()) { // (3,2): degradacja x
+            x->right.set_two(false);
+            shrunk = true;
+            return x;
+        }
+        if (y->left.two() && y->right.two()) { // (3,1) z y (2,2): degradacja x i y
+            y->left.set_two(false);
+            y->right.set_two(false);
+            shrunk = true;
+            return x;
+        }
+        shrunk = false;
+        if (!y->right.two()) { // Zewnetrzny wnuk jest 1-dzieckiem: pojedyncza rotacja
+            x->right.set(y->left.node(), y->left.two());
+            y->left.set(x, false);
+            y->right.set_two(true);
+            if (!x->left.node() && !x->right.node()) { // x zostal lisciem (2,2) - degradacja do 0
+                x->left.set_two(false);
+                x->right.set_two(false);
+                y->left.set_two(true);
+            }
+            rotations += 1;
+            return y;
+        }
+        // Wewnetrzny wnuk v zostaje korzeniem (2,2), x traci dwie rangi, y jedna
+        WAVLNode* v = y->left.node();
+        x->right.set(v->left.node(), v->left.two());
+        x->left.set_two(false);
+        y->left.set(v->right.node(), v->right.two());
+        y->right.set_two(false);
+        v->left.set(x, true);
+        v->right.set(y, true);
+        rotations += 2;
+        return v;
+    }
+
+    WAVLNode* shrunk_right(WAVLNode* x, bool& shrunk) {
+        if (!x->right.two()) {
+            x->right.set_two(true);
+            shrunk = !x->left.node() && !x->right.node();
+            if (shrunk) {
+                x->left.set_two(false);
+                x->right.set_two(false);
+            }
+            return x;
+        }
+        WAVLNode* y = x->left.node();
+        if (x->left.two()) {
+            x->left.set_two(false);
+            shrunk = true;
+            return x;
+        }
+        if (y->left.two() && y->right.two()) {
+            y->left.set_two(false);
+            y->right.set_two(false);
+            shrunk = true;
+            return x;
+        }
+        shrunk = false;
+        if (!y->left.two()) {
+            x->left.set(y->right.node(), y->right.two());
+            y->right.set(x, false);
+            y->left.set_two(true);
+            if (!x->left.node() && !x->right.node()) {
+                x->left.set_two(false);
+                x->right.set_two(false);
+                y->right.set_two(true);
+            }
+            rotations += 1;
+            return y;
+        }
+        WAVLNode* v = y->right.node();
+        x->left.set(v->right.node(), v->right.two());
+        x->right.set_two(false);
+        y->right.set(v->left.node(), v->left.two());
+        y->left.set_two(false);
+        v->right.set(x, true);
+        v->left.set(y, true);
+        rotations += 2;
+        return v;
+    }
+
+    // Wstawia klucz (lub aktualizuje wartosc); zwraca korzen poddrzewa.
+    WAVLNode* insert_wavl(WAVLNode* x, int key, int value, bool& inserted, bool& grew) {
+        if (!x) {
+            inserted = true;
+            grew = true; // Nowy lisc ma range 0, brakujace dziecko mialo -1
+            return arena.create(key, value);
+        }
+        if (key < x->key) {
+            x->left.set_node(insert_wavl(x->left.node(), key, value, inserted, grew));
+            return grew ? grown_left(x, grew) : x;
+        }
+        if (key > x->key) {
+            x->right.set_node(insert_wavl(x->right.node(), key, value, inserted, grew));
+            return grew ? grown_right(x, grew) : x;
+        }
+        x->value = value;
+        inserted = false;
+        grew = false;
+        return x;
+    }
+
+    // Doczepia istniejacy wezel jako nowy lisc (resize - wezly nie zmieniaja adresu).
+    WAVLNode* insert_node_wavl(WAVLNode* x, WAVLNode* fresh, bool& grew) {
+        if (!x) {
+            grew = true;
+            return fresh;
+        }
+        if (fresh->key < x->key) {
+            x->left.set_node(insert_node_wavl(x->left.node(), fresh, grew));
+            return grew ? grown_left(x, grew) : x;
+        }
+        x->right.set_node(insert_node_wavl(x->right.node(), fresh, grew));
+        return grew ? grown_right(x, grew) : x;
+    }
+
+    // Odlacza wezel z najmniejszym kluczem; w WAVL ma on range 0 lub 1 (wtedy jedynym dzieckiem
+    // jest lisc), wiec poddrzewo na jego miejscu ma range o 1 mniejsza.
+    WAVLNode* detach_min(WAVLNode* x, WAVLNode*& min_node, bool& shrunk) {
+        if (!x->left.node()) {
+            min_node = x;
+            shrunk = true;
+            return x->right.node();
+        }
+        x->left.set_node(detach_min(x->left.node(), min_node, shrunk));
+        return shrunk ? shrunk_left(x, shrunk) : x;
+    }
+
+    // Usuwa klucz; wezel z dwojgiem dzieci zastepuje nastepnik (przepiecie, bez kopiowania),
+    // wiec wskazniki do wartosci pozostalych elementow pozostaja wazne.
+    WAVLNode* remove_wavl(WAVLNode* x, int key, bool& removed, bool& shrunk) {
+        if (!x) {
+            removed = false;
+            shrunk = false;
+            return nullptr;
+        }
+        if (key < x->key) {
+            x->left.set_node(remove_wavl(x->left.node(), key, removed, shrunk));
+            return shrunk ? shrunk_left(x, shrunk) : x;
+        }
+        if (key > x->key) {
+            x->right.set_node(remove_wavl(x->right.node(), key, removed, shrunk));
+            return shrunk ? shrunk_right(x, shrunk) : x;
+        }
+        removed = true;
+        WAVLNode* left = x->left.node();
+        WAVLNode* right = x->right.node();
+        if (!left || !right) { // Lisc lub wezel unarny (ranga 1 z lisciem): poddrzewo traci range
+            arena.destroy(x);
+            shrunk = true;
+            return left ? left : right;
+        }
+        WAVLNode* successor = nullptr;
+        bool right_shrunk = false;
+        WAVLNode* rest = detach_min(right, successor, right_shrunk);
+        successor->left.set(left, x->left.two()); // Nastepnik przejmuje range usuwanego wezla
+        successor->right.set(rest, x->right.two());
+        arena.destroy(x);
+        shrunk = false;
+        return right_shrunk ? shrunk_right(successor, shrunk) : successor;
+    }
+
+    static const WAVLNode* find_node_wavl(const WAVLNode* node, int key) {
+        while (node && node->key != key) {
+            node = key < node->key ? node->left.node() : node->right.node();
+        }
+        return node;
+    }
+
+    // Rekurencyjnie odwiedza wezly drzewa w kolejnosci inorder (rosnace klucze).
+    static void for_each_wavl(const WAVLNode* node, const std::function<void(int, int)>& visit) {
+        if (node) {
+            for_each_wavl(node->left.node(), visit);
+            visit(node->key, node->value);
+            for_each_wavl(node->right.node(), visit);
+        }
+    }
+
+    // Sumuje glebokosci wezlow (porownania przy trafieniu) i pustych dzieci (przy chybieniu);
+    // 'misses' liczy puste dzieci.
+    static void probe_depths_wavl(const WAVLNode* node, size_t depth, double& hit_total, double& miss_total,
+                                  double& misses, size_t& max_depth) {
+        if (!node) {
+            miss_total += static_cast<double>(depth);
+            misses += 1;
+            return;
+        }
+        hit_total += static_cast<double>(depth + 1);
+        max_depth = std::max(max_depth, depth + 1);
+        probe_depths_wavl(node->left.node(), depth + 1, hit_total, miss_total, misses, max_depth);
+        probe_depths_wavl(node->right.node(), depth + 1, hit_total, miss_total, misses, max_depth);
+    }
+
+    // Wyswietla drzewo z wcieciami (prawe poddrzewo u gory) i roznicami rang dzieci.
+    static void display_wavl(const WAVLNode* node, int depth) {
+        if (node) {
+            display_wavl(node->right.node(), depth + 1);
+            for (int i = 0; i < depth; ++i) std::cout << "  ";
+            std::cout << "(" << node->key << "," << node->value << ") " << (node->left.two() ? 2 : 1) << ","
+                      << (node->right.two() ? 2 : 1) << std::endl;
+            display_wavl(node->left.node(), depth + 1);
+        }
+    }
+
+    // Alokuje wektor korzeni przy pierwszym wstawieniu (pusta tabela nie zajmuje pamieci).
+    void ensure_allocated() {
+        if (table.empty()) {
+            if (table_size == 0) table_size = 1;
+            table.resize(table_size);
+        }
+    }
+
+    // Zwieksza liczbe kubelkow 'growth_factor' razy i przepina istniejace wezly (bez alokacji).
+    void resize() {
+        auto old_table = std::move(table);
+        size_t grown = static_cast<size_t>(std::ceil(table_size * growth_factor));
+        table_size = grown > table_size ? grown : table_size + 1;
+        table.clear();
+        table.resize(table_size);
+        for (const Bucket& bucket : old_table) {
+            if (bucket.generation == generation) {
+                relink_tree(bucket.root);
+            }
+        }
+    }
+
+    // Postorder: dzieci sa odczytywane przed wyzerowaniem wezla (lisc o roznicach 1, 1).
+    void relink_tree(WAVLNode* node) {
+        if (node) {
+            relink_tree(node->left.node());
+            relink_tree(node->right.node());
+            node->left.set(nullptr, false);
+            node->right.set(nullptr, false);
+            bool grew = false;
+            WAVLNode*& root = root_at(hash_function(node->key, table_size));
+            root = insert_node_wavl(root, node, grew);
+        }
+    }
+
+public:
+    // Wektor korzeni jest alokowany leniwie - przy pierwszym insert.
+    // Wartosci spoza dozwolonego zakresu sa ignorowane (patrz set_max_load_factor / set_growth_factor).
+    explicit WAVLHashTable(size_t initial_size = 16, double max_load_factor = DEFAULT_MAX_LOAD_FACTOR,
+                           double growth_factor = DEFAULT_GROWTH_FACTOR)
+        : table_size(initial_size), current_size(0), generation(1),
+          max_load_factor(DEFAULT_MAX_LOAD_FACTOR), growth_factor(DEFAULT_GROWTH_FACTOR) {
+        set_max_load_factor(max_load_factor);
+        set_growth_factor(growth_factor);
+    }
+
+    bool insert(int key, int value) override {
+        ensure_allocated();
+        if (over_load_factor()) {
+            resize();
+        }
+
+        bool inserted = false;
+        bool grew = false;
+        WAVLNode*& root = root_at(hash_function(key, table_size));
+        root = insert_wavl(root, key, value, inserted, grew);
+        if (inserted) {
+            current_size++;
+        }
+        return true;
+    }
+
+    bool remove(int key) override {
+        if (table.empty()) return false; // Tabela jeszcze niezaalokowana
+
+        bool removed = false;
+        bool shrunk = false;
+        WAVLNode*& root = root_at(hash_function(key, table_size));
+        root = remove_wavl(root, key, removed, shrunk);
+        if (removed) {
+            current_size--;
+        }
+        return removed;
+    }
+
+    bool find(int key, int& value) override {
+        const int* found = find_ptr(key);
+        if (found) {
+            value = *found;
+            return true;
+        }
+        return false;
+    }
+
+    // Wezly sa stabilne: wskaznik pozostaje wazny do usuniecia tego klucza lub clear.
+    const int* find_ptr(int key) const override {
+        if (table.empty()) return nullptr; // Tabela jeszcze niezaalokowana
+
+        const WAVLNode* node = find_node_wavl(live_root(hash_function(key, table_size)), key);
+        return node ? &node->value : nullptr;
+    }
+
+    int* find_ptr(int key) override {
+        return const_cast<int*>(static_cast<const WAVLHashTable*>(this)->find_ptr(key));
+    }
+
+    // Wywoluje 'visit' dla kazdego elementu; w obrebie kubelka w kolejnosci rosnacych kluczy.
+    void for_each(const std::function<void(int, int)>& visit) const override {
+        for (const Bucket& bucket : table) {
+            if (bucket.generation == generation) {
+                for_each_wavl(bucket.root, visit);
+            }
+        }
+    }
+
+    void display() override {
+        std::cout << "=== WAVL Hash Table ===" << std::endl;
+        for (size_t i = 0; i < table.size(); ++i) {
+            std::cout << "Bucket " << i << ":" << std::endl;
+            if (live_root(i)) {
+                display_wavl(live_root(i), 1);
+            }
+            else {
+                std::cout << "  [EMPTY]" << std::endl;
+            }
+        }
+        std::cout << "Total Size: " << current_size << " / Table Capacity: " << table_size << std::endl;
+    }
+
+    size_t size() const override { return current_size; }
+
+    // Obiekt, wektor korzeni i bloki areny (takze wolne sloty).
+    size_t memory_usage() const override {
+        return sizeof(*this) + heap_block_bytes(table.capacity() * sizeof(Bucket)) + arena.capacity_bytes();
+    }
+
+    // Wezly porownane przy szukaniu: trafienie - glebokosc wezla, chybienie - srednia glebokosc
+    // pustych dzieci drzewa kubelka (pusty kubelek - 0 porownan).
+    bool probe_stats(ProbeStats& stats) const override {
+        stats = ProbeStats();
+        if (table.empty()) return true;
+        double hit_total = 0;
+        double miss_total = 0;
+        for (const Bucket& bucket : table) {
+            if (bucket.generation != generation || !bucket.root) continue;
+            double bucket_miss = 0;
+            double bucket_externals = 0;
+            probe_depths_wavl(bucket.root, 0, hit_total, bucket_miss, bucket_externals, stats.max_hit);
+            miss_total += bucket_miss / bucket_externals;
+        }
+        stats.average_hit = current_size ? hit_total / static_cast<double>(current_size) : 0.0;
+        stats.average_miss = miss_total / static_cast<double>(table_size);
+        return true;
+    }
+
+    // Dozwolony zakres: (0, LOAD_FACTOR_LIMIT].
+    bool set_max_load_factor(double value) override {
+        if (!(value > 0.0 && value <= LOAD_FACTOR_LIMIT)) return false;
+        max_load_factor = value;
+        while (!table.empty() && over_load_factor()) {
+            resize();
+        }
+        return true;
+    }
+
+    // Dozwolony zakres: (1, GROWTH_FACTOR_LIMIT].
+    bool set_growth_factor(double value) override {
+        if (!(value > 1.0 && value <= GROWTH_FACTOR_LIMIT)) return false;
+        growth_factor = value;
+        return true;
+    }
+
+    double get_max_load_factor() const override { return max_load_factor; }
+
+    double get_growth_factor() const override { return growth_factor; }
+
+    // Liczba rotacji od utworzenia tabeli (takze przy resize; podwojna rotacja liczy sie jako 2).
+    uint64_t rotation_count() const { return rotations; }
+
+    // Czysci tabele w czasie O(1): wezly wracaja naraz do areny, a nowa generacja
+    // sprawia, ze stare korzenie czytaja sie jako puste.
+    void clear() override {
+        clear(false);
+    }
+
+    // Przy 'release_storage' zwalnia tez pamiec areny i wektor korzeni.
+    void clear(bool release_storage) override {
+        if (release_storage) {
+            arena.release();
+            std::vector<Bucket>().swap(table);
+        }
+        else {
+            arena.reset();
+            if (++generation == 0) {
+                // Licznik generacji sie przekrecil - wyzeruj korzenie naprawde
+                for (Bucket& bucket : table) {
+                    bucket = Bucket();
+                }
+                generation = 1;
+            }
+        }
+        current_size = 0;
+    }
+
+    std::string get_name() const override {
+        return "WAVL Hash Table";
+    }
+};
+
+// Rejestracja w benchmarkach (engine_registry.h).
+inline const bool wavl_hash_table_registered = register_engine({
+    "wavl", "WAVL", "WAVL", 31, 40.0,
+    [](size_t n) { return std::unique_ptr<HashTableBase>(new WAVLHashTable(n)); } });
+
+#endif // WAVL_HASH_TABLE_H
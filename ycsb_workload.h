@@ -0,0 +1,262 @@
+#ifndef YCSB_WORKLOAD_H
+#define YCSB_WORKLOAD_H
+
+#include "hash_table_base.h" // Interfejs testowanych tabel
+#include "key_generator.h"   // SplitMix64, ZipfGenerator, key_at
+#include "precision_timer.h" // Pomiar porcji operacji i pojedynczych operacji
+#include "benchmark_stats.h" // Mediana i przedzial ufnosci przepustowosci
+#include <algorithm> // std::sort, std::min
+#include <cstdint>   // uint8_t, uint32_t, uint64_t
+#include <string>
+#include <vector>
+
+// Mieszane obciazenia w stylu YCSB (Yahoo! Cloud Serving Benchmark). Zamiast osobnych faz
+// (same wstawienia, potem same wyszukiwania) operacje roznych rodzajow sa przeplatane
+// w proporcjach typowych dla serwisow produkcyjnych:
+//
+//   A  50% odczyt, 50% aktualizacja            (np. sesje uzytkownikow)
+//   B  95% odczyt, 5% aktualizacja             (np. tagi zdjec)
+//   C  100% odczyt                             (np. cache profili)
+//   D  95% odczyt najnowszych, 5% wstawienie   (np. statusy - czytane sa swieze rekordy)
+//   E  95% krotki przeglad, 5% wstawienie      (np. watki dyskusji)
+//   F  50% odczyt, 50% odczyt-modyfikacja-zapis (np. liczniki)
+//
+// Rekord o numerze r ma klucz key_at(r, UNIFORM) - numery sa rozrzucane po calym zakresie int,
+// wiec goraca czesc rozkladu Zipfa nie trafia do kilku sasiednich kubkow (jak "scrambled
+// zipfian" w YCSB). Tabele nie maja uporzadkowanego przegladu miedzy kubkami, dlatego przeglad
+// w E to wyszukiwanie kolejnych numerow rekordow (start, start + 1, ...) - koszt jak w YCSB
+// (kilkadziesiat trafien na operacje), ale bez korzysci z porzadku kluczy w drzewie.
+//
+// Jedno powtorzenie: zaladowanie 'records' rekordow (bez pomiaru), rozgrzewka (10% operacji,
+// bez pomiaru), przebieg przepustowosci (porcje operacji mierzone w calosci) i przebieg opoznien
+// (kazda operacja mierzona osobno zegarem rdtscp z odjetym kosztem pomiaru). Osobne przebiegi
+// sprawiaja, ze koszt odczytow zegara nie zaniza przepustowosci.
+
+// Obciazenie YCSB.
+enum class YcsbWorkload { A, B, C, D, E, F };
+
+inline const char* ycsb_workload_name(YcsbWorkload workload) {
+    static const char* names[] = { "a", "b", "c", "d", "e", "f" };
+    return names[static_cast<int>(workload)];
+}
+
+inline const char* ycsb_workload_description(YcsbWorkload workload) {
+    static const char* descriptions[] = {
+        "50% read, 50% update", "95% read, 5% update", "100% read",
+        "95% read latest, 5% insert", "95% short scan, 5% insert", "50% read, 50% read-modify-write" };
+    return descriptions[static_cast<int>(workload)];
+}
+
+// Zamienia nazwe ("a" - "f", wielkosc liter dowolna) na obciazenie; zwraca false dla nieznanej.
+inline bool parse_ycsb_workload(const std::string& name, YcsbWorkload& workload) {
+    if (name.size() != 1) return false;
+    char letter = static_cast<char>(name[0] | 0x20); // Mala litera
+    if (letter < 'a' || letter > 'f') return false;
+    workload = static_cast<YcsbWorkload>(letter - 'a');
+    return true;
+}
+
+// Rodzaj pojedynczej operacji.
+enum class YcsbOperation : uint8_t { READ, UPDATE, INSERT, SCAN, READ_MODIFY_WRITE };
+
+// Udzialy operacji w obciazeniu (suma 1).
+struct YcsbMix {
+    double read = 0;
+    double update = 0;
+    double insert = 0;
+    double scan = 0;
+    double read_modify_write = 0;
+    bool latest = false; // Odczyty wybieraja najnowsze rekordy (obciazenie D)
+};
+
+inline YcsbMix ycsb_mix(YcsbWorkload workload) {
+    YcsbMix mix;
+    switch (workload) {
+    case YcsbWorkload::A: mix.read = 0.5; mix.update = 0.5; break;
+    case YcsbWorkload::B: mix.read = 0.95; mix.update = 0.05; break;
+    case YcsbWorkload::C: mix.read = 1.0; break;
+    case YcsbWorkload::D: mix.read = 0.95; mix.insert = 0.05; mix.latest = true; break;
+    case YcsbWorkload::E: mix.scan = 0.95; mix.insert = 0.05; break;
+    case YcsbWorkload::F: mix.read = 0.5; mix.read_modify_write = 0.5; break;
+    }
+    return mix;
+}
+
+// Klucz rekordu o numerze 'record'.
+inline int ycsb_key(uint64_t record) {
+    return key_at(record, KeyDistribution::UNIFORM);
+}
+
+// Jedna operacja strumienia.
+struct YcsbStep {
+    YcsbOperation operation;
+    uint32_t length;  // Liczba rekordow przegladu (tylko SCAN)
+    uint64_t record;  // Numer rekordu (dla SCAN - pierwszy rekord)
+};
+
+// Strumien operacji obciazenia. Numery rekordow sa wybierane sposrod juz wstawionych:
+// UNIFORM - rownomiernie, ZIPF - wg rozkladu Zipfa (ranga 0 najczestsza), SEQUENTIAL - po kolei.
+// W obciazeniu D rekord wybiera rozklad Zipfa liczony od najnowszego rekordu ("latest").
+// Operacje INSERT dodaja kolejne numery, wiec pozniejsze operacje moga je juz wybierac.
+class YcsbOperationGenerator {
+private:
+    YcsbMix mix;
+    KeyDistribution chooser;
+    SplitMix64 rng;
+    ZipfGenerator zipf;   // Rangi z zakresu poczatkowej liczby rekordow
+    uint64_t records;     // Liczba rekordow wstawionych do tej pory (wlacznie z wygenerowanymi INSERT)
+    uint64_t sequence;    // Pozycja dla wyboru SEQUENTIAL
+
+    uint64_t choose_record() {
+        if (mix.latest) {
+            return records - 1 - std::min(zipf.next(rng), records - 1);
+        }
+        switch (chooser) {
+        case KeyDistribution::ZIPF: return std::min(zipf.next(rng), records - 1);
+        case KeyDistribution::SEQUENTIAL: return sequence++ % records;
+        default: return rng.below(records);
+        }
+    }
+
+public:
+    static constexpr uint32_t MAX_SCAN_LENGTH = 100; // Dlugosc przegladu losowana z [1, MAX_SCAN_LENGTH]
+
+    // 'initial_records' > 0 - liczba rekordow zaladowanych przed operacjami.
+    YcsbOperationGenerator(YcsbWorkload workload, KeyDistribution chooser, uint64_t initial_records,
+                           double zipf_exponent, uint64_t seed)
+        : mix(ycsb_mix(workload)), chooser(chooser), rng(seed), zipf(initial_records, zipf_exponent),
+          records(initial_records), sequence(0) {}
+
+    YcsbStep next() {
+        YcsbStep step{ YcsbOperation::READ, 0, 0 };
+        double u = rng.uniform();
+        if ((u -= mix.read) < 0) step.operation = YcsbOperation::READ;
+        else if ((u -= mix.update) < 0) step.operation = YcsbOperation::UPDATE;
+        else if ((u -= mix.scan) < 0) step.operation = YcsbOperation::SCAN;
+        else if ((u -= mix.read_modify_write) < 0) step.operation = YcsbOperation::READ_MODIFY_WRITE;
+        else step.operation = YcsbOperation::INSERT;
+
+        if (step.operation == YcsbOperation::INSERT) {
+            step.record = records++;
+            return step;
+        }
+        step.record = choose_record();
+        if (step.operation == YcsbOperation::SCAN) {
+            // Przeglad nie wychodzi poza ostatni rekord (jak przeglad zakresu w YCSB)
+            uint64_t length = 1 + rng.below(MAX_SCAN_LENGTH);
+            step.length = static_cast<uint32_t>(std::min(length, records - step.record));
+        }
+        return step;
+    }
+
+    uint64_t record_count() const { return records; }
+};
+
+// Wykonuje operacje na tabeli; zwraca wartosc do sumy kontrolnej (aby odczyty nie zostaly usuniete).
+inline long long execute_ycsb_step(HashTableBase& table, const YcsbStep& step) {
+    int key = ycsb_key(step.record);
+    switch (step.operation) {
+    case YcsbOperation::READ: {
+        const int* value = table.find_ptr(key);
+        return value ? *value : 0;
+    }
+    case YcsbOperation::UPDATE:
+        return table.insert(key, static_cast<int>(step.record) + 1);
+    case YcsbOperation::INSERT:
+        return table.insert(key, static_cast<int>(step.record));
+    case YcsbOperation::SCAN: {
+        long long sum = 0;
+        for (uint32_t i = 0; i < step.length; ++i) {
+            const int* value = table.find_ptr(ycsb_key(step.record + i));
+            sum += value ? *value : 0;
+        }
+        return sum;
+    }
+    case YcsbOperation::READ_MODIFY_WRITE: {
+        int* value = table.find_ptr(key);
+        return value ? ++*value : 0;
+    }
+    }
+    return 0;
+}
+
+// Wynik jednego obciazenia dla jednego silnika i sposobu wyboru rekordow.
+struct YcsbResult {
+    std::string engine;
+    YcsbWorkload workload = YcsbWorkload::A;
+    std::string chooser;            // uniform, zipf, sequential lub latest (obciazenie D)
+    uint64_t records = 0;           // Rekordy zaladowane przed operacjami
+    uint64_t operations = 0;        // Operacje w przebiegu przepustowosci (i w przebiegu opoznien)
+    std::vector<double> ns_per_op;  // Przebieg przepustowosci: czas na operacje w kazdym powtorzeniu
+    std::vector<float> latencies;   // Opoznienia pojedynczych operacji ze wszystkich powtorzen (ns)
+
+    SampleSummary summary() const { return summarize_samples(ns_per_op); }
+
+    // Przepustowosc w mln operacji/s z mediany czasu na operacje.
+    double mops() const {
+        double median = summary().median;
+        return median > 0 ? 1e3 / median : 0.0;
+    }
+
+    // Percentyl opoznien (0 - 100); wymaga posortowanego 'latencies' (sort_latencies).
+    double latency_percentile(double percent) const {
+        if (latencies.empty()) return 0.0;
+        size_t index = static_cast<size_t>(percent / 100.0 * static_cast<double>(latencies.size() - 1) + 0.5);
+        return latencies[std::min(index, latencies.size() - 1)];
+    }
+
+    void sort_latencies() { std::sort(latencies.begin(), latencies.end()); }
+};
+
+// Jedno powtorzenie obciazenia na pustej tabeli 'table'. Zwraca czas na operacje przebiegu
+// przepustowosci w ns; opoznienia pojedynczych operacji sa dopisywane do 'latencies'.
+inline double run_ycsb_repetition(HashTableBase& table, YcsbWorkload workload, KeyDistribution chooser,
+                                  uint64_t records, uint64_t operations, double zipf_exponent,
+                                  uint64_t seed, std::vector<float>& latencies, long long& sink) {
+    static constexpr size_t CHUNK = 4096; // Operacje generowane porcjami poza pomiarem (bufor w L1/L2)
+    const PrecisionTimer& timer = precision_timer();
+
+    for (uint64_t record = 0; record < records; ++record) {
+        table.insert(ycsb_key(record), static_cast<int>(record));
+    }
+
+    YcsbOperationGenerator generator(workload, chooser, records, zipf_exponent, seed);
+    std::vector<YcsbStep> steps(CHUNK);
+    auto fill = [&](uint64_t remaining) {
+        size_t count = static_cast<size_t>(std::min<uint64_t>(CHUNK, remaining));
+        for (size_t i = 0; i < count; ++i) {
+            steps[i] = generator.next();
+        }
+        return count;
+    };
+
+    // Rozgrzewka: stan ustalony (tabela i cache po pierwszych operacjach mieszanych)
+    for (uint64_t done = 0, warmup = operations / 10; done < warmup;) {
+        size_t count = fill(warmup - done);
+        for (size_t i = 0; i < count; ++i) sink += execute_ycsb_step(table, steps[i]);
+        done += count;
+    }
+
+    double total_ns = 0;
+    for (uint64_t done = 0; done < operations;) {
+        size_t count = fill(operations - done);
+        uint64_t start = timer.start();
+        for (size_t i = 0; i < count; ++i) sink += execute_ycsb_step(table, steps[i]);
+        total_ns += timer.elapsed_ns(start, timer.stop());
+        done += count;
+    }
+
+    for (uint64_t done = 0; done < operations;) {
+        size_t count = fill(operations - done);
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t start = timer.start();
+            sink += execute_ycsb_step(table, steps[i]);
+            uint64_t end = timer.stop();
+            latencies.push_back(static_cast<float>(timer.elapsed_ns(start, end)));
+        }
+        done += count;
+    }
+    return operations ? total_ns / static_cast<double>(operations) : 0.0;
+}
+
+#endif // YCSB_WORKLOAD_H